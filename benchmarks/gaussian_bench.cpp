@@ -0,0 +1,56 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <string>
+#include "random/ziggurat.hpp"
+#include "random/inverse_cdf.hpp"
+
+constexpr size_t BATCH_SIZE = 1024;      // Matches MonteCarloOptimized::BATCH_SIZE
+constexpr size_t NUM_SAMPLES = 50'000'000;
+constexpr unsigned int SEED = 12345;
+
+/**
+ * Time one sampler filling BATCH_SIZE buffers, as the MC engines do
+ * @param name Label for the report
+ * @param fill Callable as fill(double* out, size_t n, std::mt19937& rng)
+ */
+template<typename FillFn>
+void run(const std::string& name, FillFn fill) {
+    std::vector<double> buffer(BATCH_SIZE);
+    std::mt19937 rng(SEED);
+    double checksum = 0.0;
+    
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t done = 0; done < NUM_SAMPLES; done += BATCH_SIZE) {
+        fill(buffer.data(), BATCH_SIZE, rng);
+        checksum += buffer[0];
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    
+    double ns = std::chrono::duration<double, std::nano>(end - start).count() / NUM_SAMPLES;
+    std::cout << std::left << std::setw(24) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(8) << ns << " ns/sample   (checksum " << checksum << ")" << std::endl;
+}
+
+int main() {
+    std::cout << "=== Gaussian sampler benchmark (" << NUM_SAMPLES / 1'000'000
+              << "M samples, std::mt19937) ===" << std::endl;
+    
+    run("std::normal_distribution", [](double* out, size_t n, std::mt19937& rng) {
+        std::normal_distribution<double> normal(0.0, 1.0);
+        for (size_t i = 0; i < n; ++i) out[i] = normal(rng);
+    });
+    run("ZigguratNormal", [](double* out, size_t n, std::mt19937& rng) {
+        ZigguratNormal::fill(out, n, rng);
+    });
+    run("InverseCdfNormal", [](double* out, size_t n, std::mt19937& rng) {
+        InverseCdfNormal::fill(out, n, rng);
+    });
+    run("std::mt19937 alone", [](double* out, size_t n, std::mt19937& rng) {
+        for (size_t i = 0; i < n; ++i) out[i] = static_cast<double>(rng());
+    });
+    
+    return 0;
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <string>
+#include <vector>
+
+/**
+ * Payoff on several underlyings, with A = Σ wᵢ·Sᵢ(T) for baskets:
+ * Basket:  max(ω·(Σ wᵢ·Sᵢ - K), 0)
+ * Spread:  max(ω·(w₁·S₁ - w₂·S₂ - K), 0)      (exactly two assets)
+ * BestOf:  max(ω·(maxᵢ wᵢ·Sᵢ - K), 0)          (rainbow)
+ * WorstOf: max(ω·(minᵢ wᵢ·Sᵢ - K), 0)          (rainbow)
+ * with ω = +1 for calls and -1 for puts.
+ */
+enum class BasketPayoff { Basket, Spread, BestOf, WorstOf };
+
+// Represents one contract on correlated underlyings (GBM, one volatility per asset)
+struct BasketOption {
+    std::string symbol;
+    BasketPayoff payoff;
+    double K;                          // Strike
+    double r;                          // Risk-free rate (annualized)
+    double T;                          // Time to maturity (years)
+    bool isCall;
+    std::vector<double> spots;         // Sᵢ, one per asset
+    std::vector<double> sigmas;        // σᵢ, one per asset
+    std::vector<double> weights;       // wᵢ, one per asset
+    std::vector<double> correlation;   // Row-major assets × assets, unit diagonal
+
+    size_t assets() const { return spots.size(); }
+};
+
+// Holds Monte Carlo results for one basket option
+struct BasketResult {
+    std::string symbol;
+    double price;
+    double stdError;  // Standard error of the price estimate
+};
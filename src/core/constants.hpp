@@ -8,4 +8,31 @@ namespace constants {
     constexpr double AS_A4 = -1.821255978;
     constexpr double AS_A5 =  1.330274429;
     constexpr double AS_P  =  0.2316419;
+
+    // Acklam rational approximation coefficients for Φ⁻¹(p)
+    constexpr double ACKLAM_A1 = -3.969683028665376e+01;
+    constexpr double ACKLAM_A2 =  2.209460984245205e+02;
+    constexpr double ACKLAM_A3 = -2.759285104469687e+02;
+    constexpr double ACKLAM_A4 =  1.383577518672690e+02;
+    constexpr double ACKLAM_A5 = -3.066479806614716e+01;
+    constexpr double ACKLAM_A6 =  2.506628277459239e+00;
+    constexpr double ACKLAM_B1 = -5.447609879822406e+01;
+    constexpr double ACKLAM_B2 =  1.615858368580409e+02;
+    constexpr double ACKLAM_B3 = -1.556989798598866e+02;
+    constexpr double ACKLAM_B4 =  6.680131188771972e+01;
+    constexpr double ACKLAM_B5 = -1.328068155288572e+01;
+    constexpr double ACKLAM_C1 = -7.784894002430293e-03;
+    constexpr double ACKLAM_C2 = -3.223964580411365e-01;
+    constexpr double ACKLAM_C3 = -2.400758277161838e+00;
+    constexpr double ACKLAM_C4 = -2.549732539343734e+00;
+    constexpr double ACKLAM_C5 =  4.374664141464968e+00;
+    constexpr double ACKLAM_C6 =  2.938163982698783e+00;
+    constexpr double ACKLAM_D1 =  7.784695709041462e-03;
+    constexpr double ACKLAM_D2 =  3.224671290700398e-01;
+    constexpr double ACKLAM_D3 =  2.445134137142996e+00;
+    constexpr double ACKLAM_D4 =  3.754408661907416e+00;
+
+    // Ziggurat (128 layers): tail start R and common layer area V
+    constexpr double ZIG_R = 3.442619855899;
+    constexpr double ZIG_V = 9.91256303526217e-3;
 }
@@ -0,0 +1,54 @@
+#pragma once
+#include <cstddef>
+#include <algorithm>
+#include "core/option.hpp"
+
+// Options processed side by side by the batched engines (8 doubles = one AVX-512 / two AVX2 registers)
+constexpr size_t SIMD_LANES = 8;
+
+/**
+ * One value per lane (GCC/Clang vector extension)
+ * Arithmetic is element-wise and compiles to packed SIMD. Engines whose inner
+ * loops carry a dependence from one grid node to the next (in-place lattice
+ * sweeps, tridiagonal recurrences) do not auto-vectorize as per-lane loops,
+ * so they operate on whole LaneVecs instead.
+ */
+typedef double LaneVec __attribute__((vector_size(SIMD_LANES * sizeof(double))));
+
+// Element-wise max(x, 0), branch-free
+inline LaneVec lane_max0(LaneVec x) {
+    return x > 0.0 ? x : 0.0;
+}
+
+/**
+ * Structure-of-arrays view of up to SIMD_LANES options
+ * Call/put and European/American are folded into multipliers (omega, american)
+ * so all lanes share one instruction stream.
+ */
+struct OptionLanes {
+    LaneVec S;
+    LaneVec K;
+    LaneVec r;
+    LaneVec sigma;
+    LaneVec T;
+    LaneVec omega;     // +1 call, -1 put
+    LaneVec american;  // 1 = early exercise, 0 = European
+    bool isCall[SIMD_LANES];
+
+    /**
+     * Load count (<= SIMD_LANES) options; unused lanes repeat the last option
+     */
+    void load(const Option* opts, size_t count) {
+        for (size_t l = 0; l < SIMD_LANES; ++l) {
+            const Option& opt = opts[std::min(l, count - 1)];
+            S[l] = opt.S;
+            K[l] = opt.K;
+            r[l] = opt.r;
+            sigma[l] = opt.sigma;
+            T[l] = opt.T;
+            omega[l] = opt.isCall ? 1.0 : -1.0;
+            american[l] = opt.isAmerican ? 1.0 : 0.0;
+            isCall[l] = opt.isCall;
+        }
+    }
+};
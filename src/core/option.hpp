@@ -10,6 +10,7 @@ struct Option {
     double sigma;        // Volatility (annualized)
     double T;            // Time to maturity (years)
     bool isCall;         // true = call, false = put
+    bool isAmerican = false;  // true = early exercise allowed (lattice/PDE engines)
 };
 
 // Holds pricing results for one option
@@ -0,0 +1,68 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include "core/option.hpp"
+#include "core/lanes.hpp"
+
+/**
+ * Batch driver shared by the lattice engines
+ * Lattice values are stored node-major, lane-minor (one LaneVec per node), so
+ * SIMD_LANES options of equal step count share every backward sweep.
+ * Runs Engine::backward at N and N/2 steps per group of lanes and combines them
+ * with Richardson extrapolation: P = (N·P_N - M·P_M) / (N - M), M = N/2,
+ * which cancels the leading O(1/N) error of the smoothed lattice.
+ *
+ * Low volatility relative to the rate pushes the branch probabilities outside
+ * [0, 1] on coarse lattices. A group whose options need more steps than
+ * requested (Engine::min_steps, at both N and N/2) is priced at that step count
+ * instead; beyond MAX_LATTICE_STEPS the option is rejected.
+ * @tparam Engine Provides nodes(steps), min_steps(opt) and backward(lanes, steps, values, price, delta)
+ */
+constexpr size_t MAX_LATTICE_STEPS = 20000;
+
+template<typename Engine>
+void lattice_price_batch(const Option* opts, size_t count, size_t steps,
+                         double* prices, double* deltas) {
+    if (steps < 4) {
+        throw std::runtime_error("Lattice requires at least 4 steps");
+    }
+
+    // One array reused for every group and both step counts (grown if a group needs more steps)
+    std::vector<LaneVec> values(Engine::nodes(steps));
+    OptionLanes lanes;
+    LaneVec p_full{}, d_full{}, p_half{}, d_half{};
+
+    for (size_t b = 0; b < count; b += SIMD_LANES) {
+        const size_t group = std::min(SIMD_LANES, count - b);
+        lanes.load(opts + b, group);
+
+        size_t group_steps = steps;
+        for (size_t l = 0; l < group; ++l) {
+            const size_t needed = 2 * Engine::min_steps(opts[b + l]);
+            if (needed > MAX_LATTICE_STEPS) {
+                throw std::runtime_error("Lattice needs " + std::to_string(needed)
+                                         + " steps for valid probabilities (volatility too low for the rate): "
+                                         + opts[b + l].symbol);
+            }
+            group_steps = std::max(group_steps, needed);
+        }
+        if (values.size() < Engine::nodes(group_steps)) values.resize(Engine::nodes(group_steps));
+
+        const size_t half = group_steps / 2;
+        const double n = static_cast<double>(group_steps);
+        const double m = static_cast<double>(half);
+
+        Engine::backward(lanes, group_steps, values.data(), p_full, d_full);
+        Engine::backward(lanes, half, values.data(), p_half, d_half);
+
+        const LaneVec price = (n * p_full - m * p_half) / (n - m);
+        const LaneVec delta = (n * d_full - m * d_half) / (n - m);
+        for (size_t l = 0; l < group; ++l) {
+            prices[b + l] = price[l];
+            if (deltas) deltas[b + l] = delta[l];
+        }
+    }
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "core/option.hpp"
+#include "math/black_scholes.hpp"
+#include "lattice/batch.hpp"
+
+/**
+ * Cox-Ross-Rubinstein binomial lattice for European and American options
+ *
+ * dt = T/N,  u = e^(σ√dt),  d = 1/u,  p = (e^(r·dt) - d) / (u - d)
+ * V(i, j) = max(e^(-r·dt)·[p·V(i+1, j+1) + (1-p)·V(i+1, j)],  exercise(i, j))
+ * where node (i, j) has spot S·u^j·d^(i-j)
+ *
+ * Accuracy (BBSR): the last step is replaced by the Black-Scholes price over dt,
+ * which removes the payoff-kink oscillation, then Richardson extrapolation
+ * over N and N/2 steps cancels the remaining O(1/N) error.
+ *
+ * Backward induction runs in place over one (N+1) × SIMD_LANES array,
+ * pricing SIMD_LANES options of equal step count per sweep.
+ */
+class BinomialLattice {
+public:
+    /**
+     * Price one option
+     * @param opt Option to price (exercise style from opt.isAmerican)
+     * @param steps Number of time steps (>= 4)
+     */
+    static double price(const Option& opt, size_t steps) {
+        double price;
+        lattice_price_batch<BinomialLattice>(&opt, 1, steps, &price, nullptr);
+        return price;
+    }
+
+    /**
+     * Price a batch of options that share a step count
+     * @param opts Options to price
+     * @param count Number of options
+     * @param steps Number of time steps (>= 4)
+     * @param prices Output prices (count entries)
+     * @param deltas Output lattice deltas (count entries, may be nullptr)
+     */
+    static void price_batch(const Option* opts, size_t count, size_t steps,
+                            double* prices, double* deltas) {
+        lattice_price_batch<BinomialLattice>(opts, count, steps, prices, deltas);
+    }
+
+    static size_t nodes(size_t steps) { return steps + 1; }
+
+    /**
+     * Fewest steps with 0 <= p <= 1: |r|·dt <= σ√dt, i.e. N >= r²T/σ²
+     */
+    static size_t min_steps(const Option& opt) {
+        return static_cast<size_t>(std::ceil(opt.r * opt.r * opt.T / (opt.sigma * opt.sigma))) + 1;
+    }
+
+    /**
+     * One smoothed backward sweep over all lanes
+     * Delta is taken from the two nodes at step 1: (V₁₁ - V₁₀) / (S·u - S·d)
+     */
+    static void backward(const OptionLanes& lanes, size_t steps, LaneVec* V,
+                         LaneVec& price, LaneVec& delta) {
+        LaneVec u, dt, start, pu, pd;
+        for (size_t l = 0; l < SIMD_LANES; ++l) {
+            dt[l] = lanes.T[l] / steps;
+            u[l] = std::exp(lanes.sigma[l] * std::sqrt(dt[l]));
+            const double d = 1.0 / u[l];
+            const double disc = std::exp(-lanes.r[l] * dt[l]);
+            const double p = (std::exp(lanes.r[l] * dt[l]) - d) / (u[l] - d);
+            pu[l] = disc * p;
+            pd[l] = disc * (1.0 - p);
+            start[l] = lanes.S[l] * std::pow(d, static_cast<double>(steps - 1));
+        }
+        const LaneVec u2 = u * u;
+
+        // Step N-1: Black-Scholes over the final dt instead of the payoff
+        LaneVec spot = start;
+        for (size_t j = 0; j < steps; ++j) {
+            LaneVec cont;
+            for (size_t l = 0; l < SIMD_LANES; ++l) {
+                cont[l] = BlackScholes::price(spot[l], lanes.K[l], lanes.r[l],
+                                              lanes.sigma[l], dt[l], lanes.isCall[l]);
+            }
+            const LaneVec exercise = lane_max0(lanes.omega * (spot - lanes.K));
+            V[j] = cont + lanes.american * lane_max0(exercise - cont);
+            spot *= u2;
+        }
+        if (steps - 1 == 1) delta = (V[1] - V[0]) / (lanes.S * (u - 1.0 / u));
+
+        // Steps N-2 .. 0, in place: node j reads nodes j and j+1 of the step above
+        for (size_t i = steps - 1; i-- > 0;) {
+            start *= u;
+            spot = start;
+            for (size_t j = 0; j <= i; ++j) {
+                const LaneVec cont = pu * V[j + 1] + pd * V[j];
+                const LaneVec exercise = lane_max0(lanes.omega * (spot - lanes.K));
+                V[j] = cont + lanes.american * lane_max0(exercise - cont);
+                spot *= u2;
+            }
+            if (i == 1) delta = (V[1] - V[0]) / (lanes.S * (u - 1.0 / u));
+        }
+
+        price = V[0];
+    }
+};
@@ -0,0 +1,106 @@
+#pragma once
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "core/option.hpp"
+#include "math/black_scholes.hpp"
+#include "lattice/batch.hpp"
+
+/**
+ * Boyle trinomial lattice in log-spot for European and American options
+ *
+ * dt = T/N,  dx = σ√(3·dt),  ν = r - σ²/2
+ * p_u = 1/6 + ν·√(dt/(12σ²)),  p_m = 2/3,  p_d = 1/6 - ν·√(dt/(12σ²))
+ * V(i, j) = max(e^(-r·dt)·[p_d·V(i+1, j) + p_m·V(i+1, j+1) + p_u·V(i+1, j+2)],  exercise(i, j))
+ * where node (i, j), j = 0..2i, has spot S·e^((j-i)·dx)
+ *
+ * Uses the same Black-Scholes last-step smoothing, Richardson extrapolation
+ * and lane-interleaved in-place layout as BinomialLattice, over a
+ * (2N+1) × SIMD_LANES array.
+ */
+class TrinomialLattice {
+public:
+    /**
+     * Price one option
+     * @param opt Option to price (exercise style from opt.isAmerican)
+     * @param steps Number of time steps (>= 4)
+     */
+    static double price(const Option& opt, size_t steps) {
+        double price;
+        lattice_price_batch<TrinomialLattice>(&opt, 1, steps, &price, nullptr);
+        return price;
+    }
+
+    /**
+     * Price a batch of options that share a step count
+     * @param opts Options to price
+     * @param count Number of options
+     * @param steps Number of time steps (>= 4)
+     * @param prices Output prices (count entries)
+     * @param deltas Output lattice deltas (count entries, may be nullptr)
+     */
+    static void price_batch(const Option* opts, size_t count, size_t steps,
+                            double* prices, double* deltas) {
+        lattice_price_batch<TrinomialLattice>(opts, count, steps, prices, deltas);
+    }
+
+    static size_t nodes(size_t steps) { return 2 * steps + 1; }
+
+    /**
+     * Fewest steps with p_u, p_d >= 0: |ν|·√(dt/(12σ²)) <= 1/6, i.e. N >= 3ν²T/σ²
+     */
+    static size_t min_steps(const Option& opt) {
+        const double nu = opt.r - 0.5 * opt.sigma * opt.sigma;
+        return static_cast<size_t>(std::ceil(3.0 * nu * nu * opt.T / (opt.sigma * opt.sigma))) + 1;
+    }
+
+    /**
+     * One smoothed backward sweep over all lanes
+     * Delta is taken from the outer nodes at step 1: (V₁₂ - V₁₀) / (S·u - S·d)
+     */
+    static void backward(const OptionLanes& lanes, size_t steps, LaneVec* V,
+                         LaneVec& price, LaneVec& delta) {
+        LaneVec u, dt, start, pu, pm, pd;
+        for (size_t l = 0; l < SIMD_LANES; ++l) {
+            const double sigma = lanes.sigma[l];
+            dt[l] = lanes.T[l] / steps;
+            u[l] = std::exp(sigma * std::sqrt(3.0 * dt[l]));
+            const double nu = lanes.r[l] - 0.5 * sigma * sigma;
+            const double tilt = nu * std::sqrt(dt[l] / (12.0 * sigma * sigma));
+            const double disc = std::exp(-lanes.r[l] * dt[l]);
+            pu[l] = disc * (1.0 / 6.0 + tilt);
+            pm[l] = disc * (2.0 / 3.0);
+            pd[l] = disc * (1.0 / 6.0 - tilt);
+            start[l] = lanes.S[l] / std::pow(u[l], static_cast<double>(steps - 1));
+        }
+
+        // Step N-1: Black-Scholes over the final dt instead of the payoff
+        LaneVec spot = start;
+        for (size_t j = 0; j < 2 * steps - 1; ++j) {
+            LaneVec cont;
+            for (size_t l = 0; l < SIMD_LANES; ++l) {
+                cont[l] = BlackScholes::price(spot[l], lanes.K[l], lanes.r[l],
+                                              lanes.sigma[l], dt[l], lanes.isCall[l]);
+            }
+            const LaneVec exercise = lane_max0(lanes.omega * (spot - lanes.K));
+            V[j] = cont + lanes.american * lane_max0(exercise - cont);
+            spot *= u;
+        }
+        if (steps - 1 == 1) delta = (V[2] - V[0]) / (lanes.S * (u - 1.0 / u));
+
+        // Steps N-2 .. 0, in place: node j reads nodes j, j+1, j+2 of the step above
+        for (size_t i = steps - 1; i-- > 0;) {
+            start *= u;
+            spot = start;
+            for (size_t j = 0; j <= 2 * i; ++j) {
+                const LaneVec cont = pu * V[j + 2] + pm * V[j + 1] + pd * V[j];
+                const LaneVec exercise = lane_max0(lanes.omega * (spot - lanes.K));
+                V[j] = cont + lanes.american * lane_max0(exercise - cont);
+                spot *= u;
+            }
+            if (i == 1) delta = (V[2] - V[0]) / (lanes.S * (u - 1.0 / u));
+        }
+
+        price = V[0];
+    }
+};
@@ -5,14 +5,42 @@
 #include <chrono>
 #include <random>
 #include <memory>
+#include <sstream>
 #include "core/option.hpp"
 #include "utils/csv_loader.hpp"
+#include "utils/basket_loader.hpp"
+#include "utils/topology.hpp"
+#include "utils/numa_executor.hpp"
 #include "math/black_scholes.hpp"
 #include "monte_carlo/baseline.hpp"
 #include "monte_carlo/optimized.hpp"
+#include "monte_carlo/basket.hpp"
+#include "lattice/binomial.hpp"
+#include "lattice/trinomial.hpp"
+#include "pde/crank_nicolson.hpp"
+#include "risk/scenario_grid.hpp"
+#include "risk/scenario_engine.hpp"
 
 constexpr size_t NUM_PATHS = 1'000'000;
+constexpr size_t LATTICE_STEPS = 1000;
+constexpr size_t PDE_SPACE_NODES = 401;
+constexpr size_t PDE_TIME_STEPS = 200;
 constexpr unsigned int BASE_SEED = 12345;
+constexpr double RISK_CONFIDENCE = 0.99;
+
+/**
+ * Pricing engine selected with --engine
+ */
+enum class Engine { MonteCarlo, Binomial, Trinomial, Pde, Basket };
+
+Engine parse_engine(const std::string& name) {
+    if (name == "mc") return Engine::MonteCarlo;
+    if (name == "binomial") return Engine::Binomial;
+    if (name == "trinomial") return Engine::Trinomial;
+    if (name == "pde") return Engine::Pde;
+    if (name == "basket") return Engine::Basket;
+    throw std::runtime_error("Unknown engine: " + name);
+}
 
 /**
  * Configuration parsed from command-line arguments
@@ -20,6 +48,9 @@ constexpr unsigned int BASE_SEED = 12345;
 struct Config {
     std::string csv_file;
     bool use_optimized = false;
+    Engine engine = Engine::MonteCarlo;
+    bool run_risk = false;
+    AffinityPolicy affinity = AffinityPolicy::None;
 };
 
 /**
@@ -30,20 +61,47 @@ struct Config {
  * @throws std::runtime_error on invalid arguments
  */
 Config parse_args(int argc, char* argv[]) {
-    if (argc < 2 || argc > 3) {
-        throw std::runtime_error("Usage: " + std::string(argv[0]) + " [--optimized] <csv_file>");
-    }
-    
+    const std::string usage = "Usage: " + std::string(argv[0])
+        + " [--optimized] [--engine mc|binomial|trinomial|pde|basket]"
+          " [--affinity compact|scatter|none] [--risk] <csv_file>";
     Config config;
+    bool engine_given = false;
     
-    if (argc == 3) {
-        if (std::string(argv[1]) != "--optimized") {
-            throw std::runtime_error("Unknown flag: " + std::string(argv[1]));
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--optimized") {
+            config.use_optimized = true;
+        } else if (arg == "--risk") {
+            config.run_risk = true;
+        } else if (arg == "--engine") {
+            if (i + 1 >= argc) throw std::runtime_error(usage);
+            config.engine = parse_engine(argv[++i]);
+            engine_given = true;
+        } else if (arg == "--affinity") {
+            if (i + 1 >= argc) throw std::runtime_error(usage);
+            config.affinity = parse_affinity(argv[++i]);
+        } else if (arg.rfind("--", 0) == 0) {
+            throw std::runtime_error("Unknown flag: " + arg);
+        } else if (config.csv_file.empty()) {
+            config.csv_file = arg;
+        } else {
+            throw std::runtime_error(usage);
         }
-        config.use_optimized = true;
-        config.csv_file = argv[2];
-    } else {
-        config.csv_file = argv[1];
+    }
+    
+    if (config.csv_file.empty()) {
+        throw std::runtime_error(usage);
+    }
+    
+    // Reject flags that the selected run would silently ignore
+    if (config.run_risk && engine_given) {
+        throw std::runtime_error("--risk cannot be combined with --engine");
+    }
+    if (config.run_risk && config.affinity != AffinityPolicy::None) {
+        throw std::runtime_error("--affinity is not supported with --risk");
+    }
+    if (config.use_optimized && config.engine != Engine::MonteCarlo) {
+        throw std::runtime_error("--optimized applies to --engine mc only");
     }
     
     return config;
@@ -51,25 +109,23 @@ Config parse_args(int argc, char* argv[]) {
 
 /**
  * Worker function for each thread
- * Processes a subset of options and stores results in pre-allocated array
+ * Processes one partition of options and stores results in its pre-allocated slice
  * @tparam MCEngine Monte Carlo engine (MonteCarlo or MonteCarloOptimized)
- * @param options Vector of options to price
- * @param start_idx Starting index in options vector
- * @param end_idx Ending index (exclusive)
- * @param results_array Pre-allocated array for results (lock-free)
+ * @param options First option of this worker's partition
+ * @param count Number of options in the partition
+ * @param results_array Pre-allocated slice for results (lock-free)
  * @param seed RNG seed for this thread
  */
 template<typename MCEngine>
 void price_options_worker(
-    const std::vector<Option>& options,
-    size_t start_idx,
-    size_t end_idx,
+    const Option* options,
+    size_t count,
     Result* results_array,
     unsigned int seed
 ) {
     std::mt19937 rng(seed);
     
-    for (size_t i = start_idx; i < end_idx; ++i) {
+    for (size_t i = 0; i < count; ++i) {
         const auto& opt = options[i];
         
         double mc_price = MCEngine::price(opt, NUM_PATHS, rng);
@@ -80,59 +136,226 @@ void price_options_worker(
     }
 }
 
+/**
+ * Worker function for lattice engines
+ * Prices the whole partition through the engine's lane-batched sweep
+ * @tparam LatticeEngine Lattice engine (BinomialLattice or TrinomialLattice)
+ * @param options First option of this worker's partition
+ * @param count Number of options in the partition
+ * @param results_array Pre-allocated slice for results (lock-free)
+ */
+template<typename LatticeEngine>
+void price_lattice_worker(
+    const Option* options,
+    size_t count,
+    Result* results_array
+) {
+    std::vector<double> prices(count), deltas(count);
+    LatticeEngine::price_batch(options, count, LATTICE_STEPS, prices.data(), deltas.data());
+    
+    for (size_t i = 0; i < count; ++i) {
+        results_array[i] = {options[i].symbol, prices[i], deltas[i], prices[i] / options[i].K};
+    }
+}
+
+/**
+ * Worker function for the Crank-Nicolson PDE engine
+ * Solves the partition's grids SIMD_LANES options at a time
+ * @param options First option of this worker's partition
+ * @param count Number of options in the partition
+ * @param results_array Pre-allocated slice for results (lock-free)
+ */
+void price_pde_worker(
+    const Option* options,
+    size_t count,
+    Result* results_array
+) {
+    std::vector<double> prices(count), deltas(count);
+    CrankNicolson::price_batch(options, count, PDE_SPACE_NODES, PDE_TIME_STEPS,
+                               prices.data(), deltas.data(), nullptr);
+    
+    for (size_t i = 0; i < count; ++i) {
+        results_array[i] = {options[i].symbol, prices[i], deltas[i], prices[i] / options[i].K};
+    }
+}
+
+/**
+ * Throughput in the engine's natural unit
+ * Monte Carlo engines (single-asset and basket) report simulated paths;
+ * deterministic engines report options
+ */
+std::string format_throughput(Engine engine, size_t num_options, double seconds) {
+    std::ostringstream out;
+    if (engine == Engine::MonteCarlo || engine == Engine::Basket) {
+        out << (num_options * NUM_PATHS) / seconds / 1e6 << " million paths/sec";
+    } else {
+        out << num_options / seconds / 1e3 << " thousand options/sec";
+    }
+    return out.str();
+}
+
+/**
+ * Pin-failure warning and per-node breakdown after an executor run
+ * (a slow node points at remote memory or oversubscription)
+ */
+void print_node_report(const NumaExecutor& executor, const Config& config) {
+    if (executor.pin_failures() > 0) {
+        std::cerr << "Warning: " << executor.pin_failures() << " of " << executor.slots().size()
+                  << " workers could not be pinned (" << affinity_name(config.affinity)
+                  << "); they ran unpinned" << std::endl;
+    }
+    
+    for (const auto& node : executor.node_stats()) {
+        if (node.threads == 0) continue;
+        std::cout << "  Node " << node.node << ": " << node.threads << " threads, "
+                  << node.options << " options, "
+                  << format_throughput(config.engine, node.options, node.elapsed_ms / 1000.0) << std::endl;
+    }
+}
+
+/**
+ * Multi-asset run: price every basket of a basket CSV with correlated Monte Carlo
+ * Baskets are partitioned across the NUMA executor's pinned workers, each with its own seed.
+ * @param config Parsed arguments (basket CSV, affinity policy)
+ * @param num_threads Worker threads
+ */
+void run_basket_pricing(const Config& config, unsigned int num_threads) {
+    auto baskets = BasketCSVLoader::load(config.csv_file);
+    size_t total_assets = 0;
+    for (const auto& b : baskets) total_assets += b.assets();
+    std::cout << "Loaded " << baskets.size() << " basket options (" << total_assets
+              << " asset legs)" << std::endl;
+    std::cout << "Mode: Correlated basket Monte Carlo (" << NUM_PATHS << " paths)" << std::endl;
+    
+    auto topology = Topology::discover();
+    NumaExecutor executor(topology, num_threads, config.affinity);
+    std::cout << "Using " << executor.slots().size() << " threads" << std::endl;
+    std::cout << "NUMA nodes: " << topology.num_nodes
+              << ", affinity: " << affinity_name(config.affinity) << std::endl;
+    
+    auto start_time = std::chrono::high_resolution_clock::now();
+    auto results = executor.run<BasketResult>(baskets,
+        [](const BasketOption* opts, size_t count, BasketResult* out, unsigned t) {
+            std::mt19937 rng(BASE_SEED + t);
+            for (size_t i = 0; i < count; ++i) {
+                double std_error = 0.0;
+                double price = BasketMonteCarlo::price(opts[i], NUM_PATHS, rng, &std_error);
+                out[i] = {opts[i].symbol, price, std_error};
+            }
+        });
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+    double seconds = std::chrono::duration<double>(end_time - start_time).count();
+    
+    std::cout << "\n=== Basket Prices ===" << std::endl;
+    std::cout << "Symbol\t\t\tAssets\tPrice\t\tStdErr" << std::endl;
+    for (size_t i = 0; i < baskets.size(); ++i) {
+        std::cout << results[i].symbol << "\t\t" << baskets[i].assets() << "\t"
+                  << results[i].price << "\t\t" << results[i].stdError << std::endl;
+    }
+    
+    std::cout << "\nTotal time: " << duration.count() << " ms" << std::endl;
+    std::cout << "Throughput: " << format_throughput(config.engine, baskets.size(), seconds)
+              << " (" << (total_assets * NUM_PATHS) / seconds / 1e6 << " million asset-paths/sec)" << std::endl;
+    print_node_report(executor, config);
+}
+
+/**
+ * Scenario risk run: revalue the book (one unit per option) under a
+ * spot × vol × rate shock ladder and report VaR/ES per underlying
+ * @param options Book to revalue
+ * @param num_threads Worker threads
+ */
+void run_scenario_risk(const std::vector<Option>& options, unsigned int num_threads) {
+    auto grid = ScenarioGrid::ladder(ScenarioGrid::range(-0.20, 0.20, 0.02),
+                                     ScenarioGrid::range(-0.10, 0.10, 0.02),
+                                     {-0.01, 0.0, 0.01});
+    std::vector<double> quantities(options.size(), 1.0);
+    std::cout << "Mode: Scenario risk (" << grid.size() << " scenarios)" << std::endl;
+    
+    auto start_time = std::chrono::high_resolution_clock::now();
+    auto report = ScenarioEngine::revalue(options, quantities, grid, RISK_CONFIDENCE, num_threads);
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+    double seconds = std::chrono::duration<double>(end_time - start_time).count();
+    
+    std::cout << "\n=== Scenario Risk by Underlying (" << RISK_CONFIDENCE * 100 << "%) ===" << std::endl;
+    std::cout << "Underlying\tVaR\t\tES" << std::endl;
+    for (size_t u = 0; u < report.underlyings.size(); ++u) {
+        std::cout << report.underlyings[u] << "\t\t" << report.var[u] << "\t\t" << report.es[u] << std::endl;
+    }
+    std::cout << "Book\t\t" << report.book_var << "\t\t" << report.book_es << std::endl;
+    
+    std::cout << "\nTotal time: " << duration.count() << " ms" << std::endl;
+    std::cout << "Throughput: " << (options.size() * grid.size()) / seconds / 1e6
+              << " million revaluations/sec" << std::endl;
+}
+
 int main(int argc, char* argv[]) {
     try {
         auto config = parse_args(argc, argv);
         
+        // Determine thread count
+        unsigned int num_threads = std::thread::hardware_concurrency();
+        if (num_threads == 0) num_threads = 4;
+        
+        // Multi-asset contracts use their own schema
+        if (config.engine == Engine::Basket) {
+            std::cout << "Loading basket options from " << config.csv_file << "..." << std::endl;
+            run_basket_pricing(config, num_threads);
+            return 0;
+        }
+        
         // Load options
         std::cout << "Loading options from " << config.csv_file << "..." << std::endl;
         auto options = CSVLoader::load(config.csv_file);
         std::cout << "Loaded " << options.size() << " options" << std::endl;
         
-        // Determine thread count
-        unsigned int num_threads = std::thread::hardware_concurrency();
-        if (num_threads == 0) num_threads = 4;
-        std::cout << "Using " << num_threads << " threads" << std::endl;
-        std::cout << "Mode: " << (config.use_optimized ? "Optimized" : "Baseline") << std::endl;
+        if (config.run_risk) {
+            std::cout << "Using " << num_threads << " threads" << std::endl;
+            run_scenario_risk(options, num_threads);
+            return 0;
+        }
+        if (config.engine == Engine::MonteCarlo) {
+            std::cout << "Mode: " << (config.use_optimized ? "Optimized" : "Baseline") << std::endl;
+        } else if (config.engine == Engine::Pde) {
+            std::cout << "Mode: Crank-Nicolson PDE (" << PDE_SPACE_NODES << " x "
+                      << PDE_TIME_STEPS << " grid)" << std::endl;
+        } else {
+            std::cout << "Mode: " << (config.engine == Engine::Binomial ? "Binomial" : "Trinomial")
+                      << " lattice (" << LATTICE_STEPS << " steps)" << std::endl;
+        }
         
-        // Pre-allocate results array (lock-free)
-        auto results = std::make_unique<Result[]>(options.size());
+        // Discover sockets/cores and place one worker per slot (capped at the usable CPUs when pinning)
+        auto topology = Topology::discover();
+        NumaExecutor executor(topology, num_threads, config.affinity);
+        std::cout << "Using " << executor.slots().size() << " threads" << std::endl;
+        std::cout << "NUMA nodes: " << topology.num_nodes
+                  << ", affinity: " << affinity_name(config.affinity) << std::endl;
         
         // Start timing
         auto start_time = std::chrono::high_resolution_clock::now();
         
-        // Partition work across threads
-        std::vector<std::thread> threads;
-        size_t options_per_thread = options.size() / num_threads;
-        
-        for (unsigned int t = 0; t < num_threads; ++t) {
-            size_t start_idx = t * options_per_thread;
-            size_t end_idx = (t == num_threads - 1) ? options.size() : (t + 1) * options_per_thread;
-            unsigned int seed = BASE_SEED + t;
-            
-            if (config.use_optimized) {
-                threads.emplace_back(
-                    price_options_worker<MonteCarloOptimized>,
-                    std::cref(options), start_idx, end_idx, results.get(), seed
-                );
-            } else {
-                threads.emplace_back(
-                    price_options_worker<MonteCarlo>,
-                    std::cref(options), start_idx, end_idx, results.get(), seed
-                );
-            }
-        }
-        
-        // Wait for all threads
-        for (auto& thread : threads) {
-            thread.join();
-        }
+        // Each worker first-touches its own input/output slice on its node
+        auto result_vec = executor.run(options,
+            [&](const Option* opts, size_t count, Result* out, unsigned t) {
+                unsigned int seed = BASE_SEED + t;
+                if (config.engine == Engine::Binomial) {
+                    price_lattice_worker<BinomialLattice>(opts, count, out);
+                } else if (config.engine == Engine::Trinomial) {
+                    price_lattice_worker<TrinomialLattice>(opts, count, out);
+                } else if (config.engine == Engine::Pde) {
+                    price_pde_worker(opts, count, out);
+                } else if (config.use_optimized) {
+                    price_options_worker<MonteCarloOptimized>(opts, count, out, seed);
+                } else {
+                    price_options_worker<MonteCarlo>(opts, count, out, seed);
+                }
+            });
         
         auto end_time = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
-        
-        // Convert to vector for sorting
-        std::vector<Result> result_vec(results.get(), results.get() + options.size());
+        double seconds = std::chrono::duration<double>(end_time - start_time).count();
         
         // Rank by expected return
         std::sort(result_vec.begin(), result_vec.end(), 
@@ -151,8 +374,9 @@ int main(int argc, char* argv[]) {
         }
         
         std::cout << "\nTotal time: " << duration.count() << " ms" << std::endl;
-        std::cout << "Throughput: " << (options.size() * NUM_PATHS) / (duration.count() / 1000.0) / 1e6 
-                  << " million paths/sec" << std::endl;
+        std::cout << "Throughput: " << format_throughput(config.engine, options.size(), seconds) << std::endl;
+        
+        print_node_report(executor, config);
         
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << std::endl;
@@ -19,15 +19,21 @@ public:
      * Price an option using Black-Scholes closed-form solution
      */
     static double price(const Option& opt) {
-        double sqrt_T = std::sqrt(opt.T);
-        double d1 = (std::log(opt.S / opt.K) + (opt.r + 0.5 * opt.sigma * opt.sigma) * opt.T) 
-                    / (opt.sigma * sqrt_T);
-        double d2 = d1 - opt.sigma * sqrt_T;
+        return price(opt.S, opt.K, opt.r, opt.sigma, opt.T, opt.isCall);
+    }
+    
+    /**
+     * Price from raw parameters (used by engines that revalue at many spots)
+     */
+    static double price(double S, double K, double r, double sigma, double T, bool isCall) {
+        double sqrt_T = std::sqrt(T);
+        double d1 = (std::log(S / K) + (r + 0.5 * sigma * sigma) * T) / (sigma * sqrt_T);
+        double d2 = d1 - sigma * sqrt_T;
         
-        double discount = std::exp(-opt.r * opt.T);
+        double discount = std::exp(-r * T);
 
-        return opt.isCall ? opt.S * norm_cdf(d1) - opt.K * discount * norm_cdf(d2)
-                          : opt.K * discount * norm_cdf(-d2) - opt.S * norm_cdf(-d1);
+        return isCall ? S * norm_cdf(d1) - K * discount * norm_cdf(d2)
+                      : K * discount * norm_cdf(-d2) - S * norm_cdf(-d1);
     }
     
     /**
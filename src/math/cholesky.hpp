@@ -0,0 +1,50 @@
+#pragma once
+#include <cmath>
+#include <vector>
+#include <stdexcept>
+
+/**
+ * Cholesky factorization C = L·Lᵀ of a symmetric positive-definite matrix
+ *
+ * L_jj = √(C_jj - Σ_(k<j) L_jk²)
+ * L_ij = (C_ij - Σ_(k<j) L_ik·L_jk) / L_jj,  i > j
+ *
+ * Used to turn independent N(0,1) draws Z into correlated ones X = L·Z.
+ */
+class Cholesky {
+public:
+    /**
+     * Factor a row-major d × d matrix
+     * Only the lower triangle of C is read.
+     * @param C Symmetric positive-definite matrix (d·d entries)
+     * @param d Dimension
+     * @return Row-major L with zeros above the diagonal
+     * @throws std::runtime_error if C is not positive definite
+     */
+    static std::vector<double> factor(const std::vector<double>& C, size_t d) {
+        if (C.size() != d * d) {
+            throw std::runtime_error("Matrix size does not match dimension");
+        }
+        std::vector<double> L(d * d, 0.0);
+
+        for (size_t j = 0; j < d; ++j) {
+            double pivot = C[j * d + j];
+            for (size_t k = 0; k < j; ++k) pivot -= L[j * d + k] * L[j * d + k];
+            if (!(pivot > PIVOT_EPS)) {
+                throw std::runtime_error("Matrix is not positive definite");
+            }
+            const double l_jj = std::sqrt(pivot);
+            L[j * d + j] = l_jj;
+
+            for (size_t i = j + 1; i < d; ++i) {
+                double sum = C[i * d + j];
+                for (size_t k = 0; k < j; ++k) sum -= L[i * d + k] * L[j * d + k];
+                L[i * d + j] = sum / l_jj;
+            }
+        }
+        return L;
+    }
+
+private:
+    static constexpr double PIVOT_EPS = 1e-12;
+};
@@ -34,3 +34,17 @@ inline double norm_cdf(double x) {
     
     return 1.0 - phi(x) * poly;
 }
+
+/**
+ * Branch-free variant of norm_cdf for vectorized loops
+ * Same Abramowitz & Stegun polynomial, with the reflection for x < 0 done by
+ * a select instead of recursion so the compiler can emit packed code.
+ */
+inline double norm_cdf_branchless(double x) {
+    double ax = std::abs(x);
+    double t = 1.0 / (1.0 + constants::AS_P * ax);
+    double poly = t * (constants::AS_A1 + t * (constants::AS_A2 + t * (constants::AS_A3
+                + t * (constants::AS_A4 + t * constants::AS_A5))));
+    double upper = 1.0 - phi(ax) * poly;
+    return x < 0.0 ? 1.0 - upper : upper;
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include <cmath>
 #include <random>
+#include <stdexcept>
 #include "core/option.hpp"
 
 /**
@@ -22,8 +23,12 @@ public:
      * @param opt Option to price
      * @param num_paths Number of simulation paths
      * @param rng Random number generator (one per thread)
+     * @throws std::runtime_error for American options (use a lattice or PDE engine)
      */
     static double price(const Option& opt, size_t num_paths, std::mt19937& rng) {
+        if (opt.isAmerican) {
+            throw std::runtime_error("Monte Carlo prices European options only; American option: " + opt.symbol);
+        }
         std::normal_distribution<double> normal(0.0, 1.0);
         
         double drift = (opt.r - 0.5 * opt.sigma * opt.sigma) * opt.T;
@@ -1,11 +1,16 @@
 #pragma once
 #include <cmath>
 #include <random>
+#include <stdexcept>
 #include "core/option.hpp"
+#include "random/ziggurat.hpp"
 
 class MonteCarloOptimized {
 public:
     static double price(const Option& opt, size_t num_paths, std::mt19937& rng) {
+        if (opt.isAmerican) {
+            throw std::runtime_error("Monte Carlo prices European options only; American option: " + opt.symbol);
+        }
         constexpr size_t BATCH_SIZE = 1024;
         const size_t num_batches = num_paths / BATCH_SIZE;
         const size_t remainder = num_paths % BATCH_SIZE;
@@ -14,15 +19,12 @@ public:
         const double diffusion = opt.sigma * std::sqrt(opt.T);
         const double discount = std::exp(-opt.r * opt.T);
         
-        std::normal_distribution<double> normal(0.0, 1.0);
         double sum_payoff = 0.0;
         
         alignas(32) double batch_randoms[BATCH_SIZE];
         
         for (size_t batch = 0; batch < num_batches; ++batch) {
-            for (size_t i = 0; i < BATCH_SIZE; ++i) {
-                batch_randoms[i] = normal(rng);
-            }
+            ZigguratNormal::fill(batch_randoms, BATCH_SIZE, rng);
             
             double batch_sum = 0.0;
             for (size_t i = 0; i < BATCH_SIZE; i += 4) {
@@ -51,8 +53,9 @@ public:
             sum_payoff += batch_sum;
         }
         
+        ZigguratNormal::fill(batch_randoms, remainder, rng);
         for (size_t i = 0; i < remainder; ++i) {
-            double Z = normal(rng);
+            double Z = batch_randoms[i];
             double S_T = opt.S * std::exp(drift + diffusion * Z);
             double payoff = opt.isCall ? std::max(S_T - opt.K, 0.0) 
                                        : std::max(opt.K - S_T, 0.0);
@@ -0,0 +1,159 @@
+#pragma once
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include "core/option.hpp"
+#include "core/lanes.hpp"
+#include "pde/thomas.hpp"
+
+/**
+ * Crank-Nicolson finite-difference pricer for European and American options
+ *
+ * Black-Scholes PDE in x = ln S and time-to-maturity τ:
+ * V_τ = ½σ²·V_xx + (r - σ²/2)·V_x - r·V
+ *
+ * Discretized on a uniform grid x_j = ln S₀ ± (j - mid)·dx, spanning
+ * ±(|ln(K/S₀)| + 5σ√T) so the strike is always well inside the grid, with
+ * (I - ½dt·L)·V^(n+1) = (I + ½dt·L)·V^n,  L·V_j = a·V_(j-1) + b·V_j + c·V_(j+1)
+ *
+ * - Rannacher start-up: the first steps are taken as two implicit Euler half
+ *   steps each, which damps the payoff kink that plain CN turns into oscillations.
+ *   The half-step matrix equals the CN matrix, so one factorization serves both.
+ * - American exercise: Brennan-Schwartz projection inside the tridiagonal solve.
+ *   Put lanes run their grid in decreasing spot so that the exercise region
+ *   is always at the high-index end, keeping call and put lanes branch-free.
+ * - Greeks: delta and gamma from central differences at S₀ (a grid node).
+ *
+ * SIMD_LANES options are solved together, one per lane of every grid vector.
+ */
+class CrankNicolson {
+public:
+    /**
+     * Price one option
+     * @param opt Option to price (exercise style from opt.isAmerican)
+     * @param space_nodes Grid points in ln S (rounded up to odd, >= 5)
+     * @param time_steps Time steps to maturity (>= 1)
+     */
+    static double price(const Option& opt, size_t space_nodes, size_t time_steps) {
+        double price;
+        price_batch(&opt, 1, space_nodes, time_steps, &price, nullptr, nullptr);
+        return price;
+    }
+
+    /**
+     * Price a batch of options on a shared grid size
+     * @param opts Options to price
+     * @param count Number of options
+     * @param space_nodes Grid points in ln S (rounded up to odd, >= 5)
+     * @param time_steps Time steps to maturity (>= 1)
+     * @param prices Output prices (count entries)
+     * @param deltas Output grid deltas (count entries, may be nullptr)
+     * @param gammas Output grid gammas (count entries, may be nullptr)
+     */
+    static void price_batch(const Option* opts, size_t count, size_t space_nodes, size_t time_steps,
+                            double* prices, double* deltas, double* gammas) {
+        if (space_nodes < 5 || time_steps < 1) {
+            throw std::runtime_error("PDE grid requires at least 5 space nodes and 1 time step");
+        }
+        const size_t nodes = space_nodes | 1;  // S₀ sits on the middle node
+
+        // Grid arrays reused for every group of lanes
+        std::vector<LaneVec> values(nodes), spot(nodes), payoff(nodes), rhs(nodes - 2);
+        BatchedThomas thomas;
+        OptionLanes lanes;
+
+        for (size_t b = 0; b < count; b += SIMD_LANES) {
+            const size_t group = std::min(SIMD_LANES, count - b);
+            lanes.load(opts + b, group);
+
+            LaneVec price, delta, gamma;
+            solve(lanes, nodes, time_steps, values.data(), spot.data(), payoff.data(),
+                  rhs.data(), thomas, price, delta, gamma);
+
+            for (size_t l = 0; l < group; ++l) {
+                prices[b + l] = price[l];
+                if (deltas) deltas[b + l] = delta[l];
+                if (gammas) gammas[b + l] = gamma[l];
+            }
+        }
+    }
+
+private:
+    static constexpr size_t RANNACHER_STEPS = 2;
+    static constexpr double GRID_STDDEVS = 5.0;  // Grid half-width beyond the strike in units of σ√T
+
+    static void solve(const OptionLanes& lanes, size_t nodes, size_t time_steps,
+                      LaneVec* V, LaneVec* spot, LaneVec* payoff, LaneVec* rhs,
+                      BatchedThomas& thomas, LaneVec& price, LaneVec& delta, LaneVec& gamma) {
+        const size_t mid = nodes / 2;
+        const size_t interior = nodes - 2;
+
+        // Per-lane grid spacing; dxs is signed (negative for puts, grid runs downward)
+        LaneVec dx, dt;
+        for (size_t l = 0; l < SIMD_LANES; ++l) {
+            const double half_width = std::abs(std::log(lanes.K[l] / lanes.S[l]))
+                                      + GRID_STDDEVS * lanes.sigma[l] * std::sqrt(lanes.T[l]);
+            dx[l] = 2.0 * half_width / (nodes - 1);
+            dt[l] = lanes.T[l] / time_steps;
+        }
+        const LaneVec dxs = lanes.omega * dx;
+        const LaneVec half_dt = 0.5 * dt;
+
+        const LaneVec alpha = 0.5 * lanes.sigma * lanes.sigma / (dx * dx);
+        const LaneVec beta = (lanes.r - 0.5 * lanes.sigma * lanes.sigma) / (2.0 * dxs);
+        const LaneVec a = alpha - beta;
+        const LaneVec bc = -2.0 * alpha - lanes.r;
+        const LaneVec c = alpha + beta;
+        thomas.factor(-half_dt * a, 1.0 - half_dt * bc, -half_dt * c, interior);
+
+        for (size_t j = 0; j < nodes; ++j) {
+            const double offset = static_cast<double>(j) - static_cast<double>(mid);
+            for (size_t l = 0; l < SIMD_LANES; ++l) {
+                spot[j][l] = lanes.S[l] * std::exp(dxs[l] * offset);
+            }
+            payoff[j] = lane_max0(lanes.omega * (spot[j] - lanes.K));
+            V[j] = payoff[j];
+        }
+
+        // Dirichlet boundaries: worthless far out of the money, forward intrinsic (floored at 0) deep in
+        auto apply_boundaries = [&](LaneVec tau) {
+            LaneVec discount;
+            for (size_t l = 0; l < SIMD_LANES; ++l) discount[l] = std::exp(-lanes.r[l] * tau[l]);
+            const LaneVec deep = lane_max0(lanes.omega * (spot[nodes-1] - lanes.K * discount));
+            V[0] = LaneVec{};
+            V[nodes-1] = deep + lanes.american * lane_max0(payoff[nodes-1] - deep);
+        };
+
+        LaneVec tau = LaneVec{};
+        for (size_t step = 0; step < time_steps; ++step) {
+            if (step < RANNACHER_STEPS) {
+                // Two implicit Euler half steps: (I - ½dt·L)·V^(new) = V^(old)
+                for (int sub = 0; sub < 2; ++sub) {
+                    tau += half_dt;
+                    for (size_t i = 0; i < interior; ++i) rhs[i] = V[i+1];
+                    apply_boundaries(tau);
+                    rhs[0] += half_dt * a * V[0];
+                    rhs[interior-1] += half_dt * c * V[nodes-1];
+                    thomas.solve_projected(rhs, payoff + 1, lanes.american, V + 1);
+                }
+            } else {
+                // Crank-Nicolson: (I - ½dt·L)·V^(new) = (I + ½dt·L)·V^(old)
+                for (size_t i = 0; i < interior; ++i) {
+                    rhs[i] = V[i+1] + half_dt * (a * V[i] + bc * V[i+1] + c * V[i+2]);
+                }
+                tau += dt;
+                apply_boundaries(tau);
+                rhs[0] += half_dt * a * V[0];
+                rhs[interior-1] += half_dt * c * V[nodes-1];
+                thomas.solve_projected(rhs, payoff + 1, lanes.american, V + 1);
+            }
+        }
+
+        const LaneVec v_x = (V[mid+1] - V[mid-1]) / (2.0 * dxs);
+        const LaneVec v_xx = (V[mid+1] - 2.0 * V[mid] + V[mid-1]) / (dx * dx);
+        price = V[mid];
+        delta = v_x / lanes.S;
+        gamma = (v_xx - v_x) / (lanes.S * lanes.S);
+    }
+};
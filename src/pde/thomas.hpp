@@ -0,0 +1,76 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "core/lanes.hpp"
+
+/**
+ * Batched Thomas solver for SIMD_LANES tridiagonal systems at once
+ *
+ * lower·x[j-1] + diag·x[j] + upper·x[j+1] = rhs[j],   j = 0..n-1
+ *
+ * Bands are constant along j but differ per lane (one system per option), so
+ * the elimination factors are computed once by factor() and reused by every
+ * solve() — a Crank-Nicolson time loop only pays for the two O(n) sweeps.
+ * Each recurrence step operates on whole LaneVecs, so all lanes advance in
+ * the same packed instructions.
+ */
+class BatchedThomas {
+public:
+    /**
+     * Precompute the forward-elimination factors
+     * c'[0] = upper / diag,  c'[j] = upper / (diag - lower·c'[j-1])
+     */
+    void factor(LaneVec lower, LaneVec diag, LaneVec upper, size_t n) {
+        lower_ = lower;
+        cp_.resize(n);
+        inv_.resize(n);
+        inv_[0] = 1.0 / diag;
+        cp_[0] = upper * inv_[0];
+        for (size_t j = 1; j < n; ++j) {
+            inv_[j] = 1.0 / (diag - lower * cp_[j-1]);
+            cp_[j] = upper * inv_[j];
+        }
+    }
+
+    /**
+     * Solve for x (rhs and x may alias)
+     */
+    void solve(const LaneVec* rhs, LaneVec* x) const {
+        forward(rhs, x);
+        const size_t n = cp_.size();
+        for (size_t j = n - 1; j-- > 0;) {
+            x[j] -= cp_[j] * x[j+1];
+        }
+    }
+
+    /**
+     * Brennan-Schwartz projected solve for the obstacle problem x ≥ obstacle
+     * Back-substitution starts at j = n-1, so the exercise region must lie at
+     * the high-index end of the grid; each value is projected onto the obstacle
+     * as soon as it is known. Lanes with american = 0 get the plain solve.
+     */
+    void solve_projected(const LaneVec* rhs, const LaneVec* obstacle, LaneVec american,
+                         LaneVec* x) const {
+        forward(rhs, x);
+        const size_t n = cp_.size();
+        x[n-1] += american * lane_max0(obstacle[n-1] - x[n-1]);
+        for (size_t j = n - 1; j-- > 0;) {
+            const LaneVec free = x[j] - cp_[j] * x[j+1];
+            x[j] = free + american * lane_max0(obstacle[j] - free);
+        }
+    }
+
+private:
+    LaneVec lower_{};
+    std::vector<LaneVec> cp_;   // Modified upper band c'
+    std::vector<LaneVec> inv_;  // 1 / pivot
+
+    // d'[j] = (rhs[j] - lower·d'[j-1]) / pivot[j], written into x
+    void forward(const LaneVec* rhs, LaneVec* x) const {
+        const size_t n = cp_.size();
+        x[0] = rhs[0] * inv_[0];
+        for (size_t j = 1; j < n; ++j) {
+            x[j] = (rhs[j] - lower_ * x[j-1]) * inv_[j];
+        }
+    }
+};
@@ -0,0 +1,60 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include <stdexcept>
+
+/**
+ * One market scenario applied to every position
+ * spot: relative shock, S' = S·(1 + spot)
+ * vol:  absolute shift in annualized volatility, σ' = σ + vol
+ * rate: absolute shift in the risk-free rate, r' = r + rate
+ */
+struct Shock {
+    double spot;
+    double vol;
+    double rate;
+};
+
+/**
+ * Set of scenarios to revalue a book under
+ */
+class ScenarioGrid {
+public:
+    std::vector<Shock> shocks;
+
+    /**
+     * Full cartesian ladder: every spot shock × every vol shock × every rate shock
+     * Ordered rate-major, then vol, then spot (spot varies fastest).
+     */
+    static ScenarioGrid ladder(const std::vector<double>& spot_shocks,
+                               const std::vector<double>& vol_shocks,
+                               const std::vector<double>& rate_shocks = {0.0}) {
+        ScenarioGrid grid;
+        for (double dr : rate_shocks) {
+            for (double dv : vol_shocks) {
+                for (double ds : spot_shocks) {
+                    if (ds <= -1.0) {
+                        throw std::runtime_error("Spot shock must be greater than -100%");
+                    }
+                    grid.shocks.push_back({ds, dv, dr});
+                }
+            }
+        }
+        return grid;
+    }
+
+    /**
+     * Evenly spaced shocks from lo to hi inclusive, e.g. range(-0.2, 0.2, 0.02)
+     */
+    static std::vector<double> range(double lo, double hi, double step) {
+        if (step <= 0.0 || hi < lo) {
+            throw std::runtime_error("Invalid shock range");
+        }
+        std::vector<double> values;
+        const size_t n = static_cast<size_t>(std::floor((hi - lo) / step + 0.5));
+        for (size_t i = 0; i <= n; ++i) values.push_back(lo + i * step);
+        return values;
+    }
+
+    size_t size() const { return shocks.size(); }
+};
@@ -0,0 +1,176 @@
+#pragma once
+#include <cmath>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include "core/basket_option.hpp"
+#include "math/cholesky.hpp"
+
+/**
+ * CSV loader for multi-asset options
+ * Expected format: symbol,payoff,K,r,T,isCall,spots,sigmas,weights,correlation
+ *
+ * - payoff: basket | spread | bestof | worstof
+ * - spots, sigmas, weights: ';'-separated, one entry per asset. An empty
+ *   weights column means 1/n for baskets and 1 otherwise.
+ * - correlation: ';'-separated, one of
+ *     ρ                  a single value for every pair
+ *     n·(n-1)/2 values   strict upper triangle, row by row
+ *     n·n values         the full row-major matrix
+ *   The resulting matrix must be positive definite.
+ */
+class BasketCSVLoader {
+public:
+    /**
+     * Load basket options from CSV file
+     * @param filename Path to CSV file
+     * @return Vector of BasketOption structs
+     * @throws std::runtime_error if file cannot be opened or data is invalid
+     */
+    static std::vector<BasketOption> load(const std::string& filename) {
+        std::ifstream file(filename);
+        if (!file.is_open()) {
+            throw std::runtime_error("Cannot open file: " + filename);
+        }
+
+        std::vector<BasketOption> options;
+        std::string line;
+
+        // Skip header line
+        std::getline(file, line);
+
+        while (std::getline(file, line)) {
+            if (line.empty()) continue;
+
+            BasketOption opt = parse_option(line);
+            validate(opt);
+            options.push_back(opt);
+        }
+
+        return options;
+    }
+
+    /**
+     * Parse one data row (no header)
+     * @throws std::runtime_error if the row is invalid
+     */
+    static BasketOption parse_option(const std::string& line) {
+        std::stringstream ss(line);
+        std::string token;
+        BasketOption opt;
+
+        std::getline(ss, opt.symbol, ',');
+        std::getline(ss, token, ','); opt.payoff = parse_payoff(token);
+        std::getline(ss, token, ','); opt.K = std::stod(token);
+        std::getline(ss, token, ','); opt.r = std::stod(token);
+        std::getline(ss, token, ','); opt.T = std::stod(token);
+        std::getline(ss, token, ','); opt.isCall = (std::stoi(token) == 1);
+        std::getline(ss, token, ','); opt.spots = parse_list(token);
+        std::getline(ss, token, ','); opt.sigmas = parse_list(token);
+        std::getline(ss, token, ','); opt.weights = parse_list(token);
+        token.clear();
+        std::getline(ss, token, ',');
+
+        const size_t n = opt.assets();
+        if (opt.weights.empty()) {
+            opt.weights.assign(n, opt.payoff == BasketPayoff::Basket ? 1.0 / n : 1.0);
+        }
+        opt.correlation = expand_correlation(parse_list(token), n, opt.symbol);
+
+        return opt;
+    }
+
+private:
+    static BasketPayoff parse_payoff(const std::string& name) {
+        if (name == "basket") return BasketPayoff::Basket;
+        if (name == "spread") return BasketPayoff::Spread;
+        if (name == "bestof") return BasketPayoff::BestOf;
+        if (name == "worstof") return BasketPayoff::WorstOf;
+        throw std::runtime_error("Unknown basket payoff: " + name);
+    }
+
+    static std::vector<double> parse_list(const std::string& cell) {
+        std::vector<double> values;
+        std::stringstream ss(cell);
+        std::string token;
+        while (std::getline(ss, token, ';')) {
+            if (!token.empty()) values.push_back(std::stod(token));
+        }
+        return values;
+    }
+
+    static std::vector<double> expand_correlation(const std::vector<double>& values, size_t n,
+                                                  const std::string& symbol) {
+        std::vector<double> C(n * n, 0.0);
+        for (size_t i = 0; i < n; ++i) C[i * n + i] = 1.0;
+
+        if (values.size() == n * n) {
+            C = values;
+        } else if (values.size() == n * (n - 1) / 2) {
+            size_t idx = 0;
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = i + 1; j < n; ++j) {
+                    C[i * n + j] = C[j * n + i] = values[idx++];
+                }
+            }
+        } else if (values.size() == 1) {
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < n; ++j) {
+                    if (i != j) C[i * n + j] = values[0];
+                }
+            }
+        } else {
+            throw std::runtime_error("Correlation entries do not match asset count: " + symbol);
+        }
+        return C;
+    }
+
+    static void validate(const BasketOption& opt) {
+        const size_t n = opt.assets();
+        if (n == 0) {
+            throw std::runtime_error("No assets: " + opt.symbol);
+        }
+        if (opt.sigmas.size() != n || opt.weights.size() != n) {
+            throw std::runtime_error("Asset lists differ in length: " + opt.symbol);
+        }
+        if (opt.payoff == BasketPayoff::Spread && n != 2) {
+            throw std::runtime_error("Spread requires exactly two assets: " + opt.symbol);
+        }
+        if (opt.K < 0.0) {
+            throw std::runtime_error("Invalid strike price: " + opt.symbol);
+        }
+        if (opt.T <= 0.0) {
+            throw std::runtime_error("Invalid time to maturity: " + opt.symbol);
+        }
+        for (size_t i = 0; i < n; ++i) {
+            if (opt.spots[i] <= 0.0) {
+                throw std::runtime_error("Invalid spot price: " + opt.symbol);
+            }
+            if (opt.sigmas[i] <= 0.0) {
+                throw std::runtime_error("Invalid volatility: " + opt.symbol);
+            }
+            if (opt.payoff != BasketPayoff::Basket && opt.weights[i] <= 0.0) {
+                throw std::runtime_error("Spread and rainbow weights must be positive: " + opt.symbol);
+            }
+        }
+        for (size_t i = 0; i < n; ++i) {
+            if (opt.correlation[i * n + i] != 1.0) {
+                throw std::runtime_error("Correlation diagonal must be 1: " + opt.symbol);
+            }
+            for (size_t j = 0; j < i; ++j) {
+                const double rho = opt.correlation[i * n + j];
+                if (std::abs(rho) > 1.0 || rho != opt.correlation[j * n + i]) {
+                    throw std::runtime_error("Invalid correlation matrix: " + opt.symbol);
+                }
+            }
+        }
+        // Reject here rather than when the pricer factors it
+        try {
+            Cholesky::factor(opt.correlation, n);
+        } catch (const std::runtime_error&) {
+            throw std::runtime_error("Correlation matrix is not positive definite: " + opt.symbol);
+        }
+    }
+};
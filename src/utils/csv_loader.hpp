@@ -8,7 +8,8 @@
 
 /**
  * CSV loader for options data
- * Expected format: symbol,S,K,r,sigma,T,isCall
+ * Expected format: symbol,S,K,r,sigma,T,isCall[,isAmerican]
+ * The trailing exercise column is optional and defaults to European.
  */
 class CSVLoader {
 public:
@@ -54,6 +55,9 @@ private:
         std::getline(ss, token, ','); opt.sigma = std::stod(token);
         std::getline(ss, token, ','); opt.T = std::stod(token);
         std::getline(ss, token, ','); opt.isCall = (std::stoi(token) == 1);
+        if (std::getline(ss, token, ',') && !token.empty()) {
+            opt.isAmerican = (std::stoi(token) == 1);
+        }
         
         return opt;
     }
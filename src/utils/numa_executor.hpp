@@ -0,0 +1,165 @@
+#pragma once
+#include <vector>
+#include <thread>
+#include <memory>
+#include <chrono>
+#include <algorithm>
+#include <exception>
+#include "core/option.hpp"
+#include "utils/topology.hpp"
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// Aggregated timing for the workers that ran on one NUMA node
+struct NodeStats {
+    unsigned node;
+    unsigned threads;
+    size_t options;     // Items (options or baskets) processed on this node
+    double elapsed_ms;  // Slowest worker on this node
+};
+
+/**
+ * Topology-aware executor
+ * Pins one worker per CPU slot according to the affinity policy, then lets each
+ * worker allocate and first-touch its own slice of the input and output buffers
+ * so that, under Linux's first-touch page placement, every option a worker reads
+ * and every result it writes lives on the worker's local node.
+ *
+ * A worker whose pin request is refused (e.g. its CPU is outside a cgroup or
+ * taskset mask) keeps running unpinned; such workers are counted in pin_failures().
+ *
+ * When pinning, the pool is capped at one worker per available CPU: workers
+ * hard-pinned to a shared CPU could not be rebalanced by the scheduler.
+ */
+class NumaExecutor {
+public:
+    NumaExecutor(const Topology& topo, unsigned num_threads, AffinityPolicy policy)
+        : topo_(topo), policy_(policy), slots_(topo.placement(pool_size(topo, num_threads, policy), policy)) {}
+
+    /**
+     * Run worker_fn over contiguous, balanced partitions of options
+     * An exception thrown by a worker is rethrown here once every worker has finished.
+     * @tparam Out Result type (Result for single-asset engines)
+     * @tparam In Input type, deduced (Option, BasketOption, ...)
+     * @tparam WorkerFn Callable as fn(const In* opts, size_t count, Out* out, unsigned worker)
+     * @param options Inputs to price (read once by the owning worker)
+     * @return Results in the same order as options
+     */
+    template<typename Out = Result, typename In, typename WorkerFn>
+    std::vector<Out> run(const std::vector<In>& options, WorkerFn worker_fn) {
+        const unsigned num_threads = static_cast<unsigned>(slots_.size());
+        std::vector<Partition<In, Out>> parts(num_threads);
+        std::vector<std::thread> threads;
+
+        for (unsigned t = 0; t < num_threads; ++t) {
+            // Balanced split: partition sizes differ by at most one
+            size_t start_idx = options.size() * t / num_threads;
+            size_t end_idx = options.size() * (t + 1) / num_threads;
+
+            threads.emplace_back([&, t, start_idx, end_idx] {
+                auto& part = parts[t];
+                if (policy_ != AffinityPolicy::None) part.pinned = pin_current_thread(slots_[t].id);
+                part.node = current_node(slots_[t]);
+
+                auto start = std::chrono::high_resolution_clock::now();
+
+                try {
+                    // First touch: both slices are allocated and written from this thread
+                    part.options.assign(options.begin() + start_idx, options.begin() + end_idx);
+                    part.results = std::make_unique<Out[]>(part.options.size());
+                    part.count = part.options.size();
+
+                    worker_fn(part.options.data(), part.count, part.results.get(), t);
+                } catch (...) {
+                    part.error = std::current_exception();
+                }
+
+                auto end = std::chrono::high_resolution_clock::now();
+                part.elapsed_ms = std::chrono::duration<double, std::milli>(end - start).count();
+            });
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (const auto& part : parts) {
+            if (part.error) std::rethrow_exception(part.error);
+        }
+
+        std::vector<Out> results;
+        results.reserve(options.size());
+        node_stats_.assign(topo_.num_nodes, NodeStats{0, 0, 0, 0.0});
+        pin_failures_ = 0;
+        for (unsigned n = 0; n < topo_.num_nodes; ++n) node_stats_[n].node = n;
+
+        for (const auto& part : parts) {
+            results.insert(results.end(), part.results.get(), part.results.get() + part.count);
+            auto& stats = node_stats_[part.node];
+            stats.threads += 1;
+            stats.options += part.count;
+            stats.elapsed_ms = std::max(stats.elapsed_ms, part.elapsed_ms);
+            if (!part.pinned) ++pin_failures_;
+        }
+        return results;
+    }
+
+    // Per-node statistics from the last run (nodes with no workers have threads == 0)
+    const std::vector<NodeStats>& node_stats() const { return node_stats_; }
+
+    // Workers of the last run that could not be pinned to their slot
+    unsigned pin_failures() const { return pin_failures_; }
+
+    // CPU chosen for each worker
+    const std::vector<CpuInfo>& slots() const { return slots_; }
+
+private:
+    template<typename In, typename Out>
+    struct Partition {
+        std::vector<In> options;
+        std::unique_ptr<Out[]> results;
+        size_t count = 0;
+        unsigned node = 0;
+        double elapsed_ms = 0.0;
+        bool pinned = true;
+        std::exception_ptr error;
+    };
+
+    const Topology& topo_;
+    AffinityPolicy policy_;
+    std::vector<CpuInfo> slots_;
+    std::vector<NodeStats> node_stats_;
+    unsigned pin_failures_ = 0;
+
+    // Workers to start: as requested when unpinned, at most one per CPU when pinned
+    static unsigned pool_size(const Topology& topo, unsigned num_threads, AffinityPolicy policy) {
+        if (num_threads == 0) num_threads = 1;
+        if (policy == AffinityPolicy::None || topo.cpus.empty()) return num_threads;
+        return std::min(num_threads, static_cast<unsigned>(topo.cpus.size()));
+    }
+
+    // @return false if the kernel rejected the request
+    static bool pin_current_thread([[maybe_unused]] unsigned cpu) {
+#ifdef __linux__
+        if (cpu >= CPU_SETSIZE) return false;
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+        return true;
+#endif
+    }
+
+    // Node the calling thread is actually running on (unpinned threads may differ from the slot)
+    unsigned current_node(const CpuInfo& slot) const {
+#ifdef __linux__
+        int cpu = sched_getcpu();
+        for (const auto& info : topo_.cpus) {
+            if (static_cast<int>(info.id) == cpu) return info.node;
+        }
+#endif
+        return slot.node;
+    }
+};
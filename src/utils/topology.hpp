@@ -0,0 +1,220 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <filesystem>
+#include <cctype>
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+/**
+ * Thread placement policy across NUMA nodes
+ * Compact: fill every core of node 0 before moving to node 1
+ * Scatter: round-robin workers across nodes
+ * None:    leave placement to the OS scheduler
+ */
+enum class AffinityPolicy { Compact, Scatter, None };
+
+/**
+ * Parse an affinity policy name
+ * @throws std::runtime_error on unknown policy
+ */
+inline AffinityPolicy parse_affinity(const std::string& name) {
+    if (name == "compact") return AffinityPolicy::Compact;
+    if (name == "scatter") return AffinityPolicy::Scatter;
+    if (name == "none") return AffinityPolicy::None;
+    throw std::runtime_error("Unknown affinity policy: " + name);
+}
+
+inline const char* affinity_name(AffinityPolicy policy) {
+    switch (policy) {
+        case AffinityPolicy::Compact: return "compact";
+        case AffinityPolicy::Scatter: return "scatter";
+        default:                      return "none";
+    }
+}
+
+// One logical CPU and where it sits in the machine
+struct CpuInfo {
+    unsigned id;      // Logical CPU number (as used by sched_setaffinity)
+    unsigned node;    // NUMA node
+    unsigned socket;  // Physical package
+    unsigned core;    // Physical core within the package
+};
+
+/**
+ * Machine topology discovered from sysfs
+ * Reads node*\/cpulist for the NUMA layout and cpu*\/topology for sockets/cores.
+ * Falls back to a single node when sysfs has no NUMA information (e.g. macOS,
+ * kernels without NUMA support): the CPUs of this process's affinity mask, or
+ * 0..hardware_concurrency()-1 where no mask is available.
+ */
+class Topology {
+public:
+    std::vector<CpuInfo> cpus;  // Sorted by (node, socket, core, id)
+    unsigned num_nodes = 1;
+
+    /**
+     * Discover topology
+     * @param sysfs_root Root of the sysfs system tree (overridable for tests)
+     * @param only_allowed Drop CPUs outside this process's affinity mask
+     */
+    static Topology discover(const std::string& sysfs_root = "/sys/devices/system",
+                             bool only_allowed = true) {
+        namespace fs = std::filesystem;
+        Topology topo;
+        const fs::path node_dir = fs::path(sysfs_root) / "node";
+        const fs::path cpu_dir = fs::path(sysfs_root) / "cpu";
+
+        std::error_code ec;
+        std::vector<unsigned> node_ids;
+        for (const auto& entry : fs::directory_iterator(node_dir, ec)) {
+            const std::string name = entry.path().filename().string();
+            if (name.size() > 4 && name.rfind("node", 0) == 0
+                && std::all_of(name.begin() + 4, name.end(), ::isdigit)) {
+                node_ids.push_back(std::stoul(name.substr(4)));
+            }
+        }
+        std::sort(node_ids.begin(), node_ids.end());
+
+        for (unsigned node : node_ids) {
+            std::string list;
+            if (!read_line(node_dir / ("node" + std::to_string(node)) / "cpulist", list)) continue;
+            for (unsigned id : parse_cpulist(list)) {
+                if (only_allowed && !is_allowed(id)) continue;
+                const fs::path topo_dir = cpu_dir / ("cpu" + std::to_string(id)) / "topology";
+                CpuInfo cpu{id, node, read_uint(topo_dir / "physical_package_id", node),
+                            read_uint(topo_dir / "core_id", id)};
+                topo.cpus.push_back(cpu);
+            }
+        }
+
+        if (topo.cpus.empty()) {
+            std::vector<unsigned> ids = only_allowed ? allowed_cpus() : std::vector<unsigned>{};
+            if (ids.empty()) {
+                unsigned n = std::thread::hardware_concurrency();
+                if (n == 0) n = 4;
+                for (unsigned id = 0; id < n; ++id) ids.push_back(id);
+            }
+            for (unsigned id : ids) topo.cpus.push_back({id, 0, 0, id});
+            topo.num_nodes = 1;
+            return topo;
+        }
+
+        // Renumber nodes densely so per-node arrays can be indexed directly
+        std::vector<unsigned> seen;
+        for (const auto& cpu : topo.cpus) {
+            if (std::find(seen.begin(), seen.end(), cpu.node) == seen.end()) seen.push_back(cpu.node);
+        }
+        for (auto& cpu : topo.cpus) {
+            cpu.node = static_cast<unsigned>(std::find(seen.begin(), seen.end(), cpu.node) - seen.begin());
+        }
+        topo.num_nodes = static_cast<unsigned>(seen.size());
+
+        std::sort(topo.cpus.begin(), topo.cpus.end(), [](const CpuInfo& a, const CpuInfo& b) {
+            if (a.node != b.node) return a.node < b.node;
+            if (a.socket != b.socket) return a.socket < b.socket;
+            if (a.core != b.core) return a.core < b.core;
+            return a.id < b.id;
+        });
+        return topo;
+    }
+
+    /**
+     * Order in which workers should be placed on CPUs
+     * Within a node, distinct physical cores come before SMT siblings.
+     * @return One CpuInfo per worker slot (cycles if num_threads > cpus)
+     */
+    std::vector<CpuInfo> placement(unsigned num_threads, AffinityPolicy policy) const {
+        std::vector<std::vector<CpuInfo>> per_node(num_nodes);
+        for (const auto& cpu : cpus) per_node[cpu.node].push_back(cpu);
+        for (auto& list : per_node) list = spread_cores(list);
+
+        std::vector<CpuInfo> order;
+        if (policy == AffinityPolicy::Scatter) {
+            size_t longest = 0;
+            for (const auto& list : per_node) longest = std::max(longest, list.size());
+            for (size_t i = 0; i < longest; ++i) {
+                for (const auto& list : per_node) {
+                    if (i < list.size()) order.push_back(list[i]);
+                }
+            }
+        } else {
+            for (const auto& list : per_node) order.insert(order.end(), list.begin(), list.end());
+        }
+
+        std::vector<CpuInfo> slots;
+        for (unsigned t = 0; t < num_threads; ++t) slots.push_back(order[t % order.size()]);
+        return slots;
+    }
+
+    /**
+     * Parse a sysfs CPU list such as "0-3,8,10-11"
+     */
+    static std::vector<unsigned> parse_cpulist(const std::string& list) {
+        std::vector<unsigned> ids;
+        std::stringstream ss(list);
+        std::string range;
+        while (std::getline(ss, range, ',')) {
+            if (range.empty() || range == "\n") continue;
+            size_t dash = range.find('-');
+            unsigned lo = std::stoul(range.substr(0, dash));
+            unsigned hi = (dash == std::string::npos) ? lo : std::stoul(range.substr(dash + 1));
+            for (unsigned id = lo; id <= hi; ++id) ids.push_back(id);
+        }
+        return ids;
+    }
+
+private:
+    // Reorder so the first SMT thread of every core precedes any second thread
+    static std::vector<CpuInfo> spread_cores(const std::vector<CpuInfo>& list) {
+        std::vector<CpuInfo> primary, siblings;
+        for (size_t i = 0; i < list.size(); ++i) {
+            bool same_core = i > 0 && list[i].socket == list[i-1].socket && list[i].core == list[i-1].core;
+            (same_core ? siblings : primary).push_back(list[i]);
+        }
+        primary.insert(primary.end(), siblings.begin(), siblings.end());
+        return primary;
+    }
+
+    static bool read_line(const std::filesystem::path& path, std::string& out) {
+        std::ifstream file(path);
+        return file.is_open() && std::getline(file, out) && !out.empty();
+    }
+
+    static unsigned read_uint(const std::filesystem::path& path, unsigned fallback) {
+        std::string line;
+        return read_line(path, line) ? static_cast<unsigned>(std::stoul(line)) : fallback;
+    }
+
+    // Respect cgroup/taskset restrictions on the current process
+    static bool is_allowed([[maybe_unused]] unsigned id) {
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (sched_getaffinity(0, sizeof(set), &set) != 0) return true;
+        return id >= CPU_SETSIZE || CPU_ISSET(id, &set);
+#else
+        return true;
+#endif
+    }
+
+    // CPUs in this process's affinity mask (empty if it cannot be read)
+    static std::vector<unsigned> allowed_cpus() {
+        std::vector<unsigned> ids;
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (sched_getaffinity(0, sizeof(set), &set) != 0) return ids;
+        for (unsigned id = 0; id < CPU_SETSIZE; ++id) {
+            if (CPU_ISSET(id, &set)) ids.push_back(id);
+        }
+#endif
+        return ids;
+    }
+};
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include "core/option.hpp"
+#include "lattice/binomial.hpp"
+#include "math/black_scholes.hpp"
+
+class BinomialLatticeTest : public ::testing::Test {};
+
+TEST_F(BinomialLatticeTest, EuropeanCallMatchesBs) {
+    Option opt = {"TEST", 100.0, 100.0, 0.05, 0.2, 1.0, true};
+    double bs_price = BlackScholes::price(opt);
+    EXPECT_NEAR(BinomialLattice::price(opt, 200), bs_price, bs_price * 1e-3);
+}
+
+TEST_F(BinomialLatticeTest, EuropeanPutMatchesBs) {
+    Option opt = {"TEST", 90.0, 100.0, 0.05, 0.3, 0.5, false};
+    double bs_price = BlackScholes::price(opt);
+    EXPECT_NEAR(BinomialLattice::price(opt, 200), bs_price, bs_price * 1e-3);
+}
+
+TEST_F(BinomialLatticeTest, AmericanPutReference) {
+    // Reference value 6.0904 (high-resolution lattice)
+    Option opt = {"TEST", 100.0, 100.0, 0.05, 0.2, 1.0, false, true};
+    EXPECT_NEAR(BinomialLattice::price(opt, 500), 6.0904, 5e-3);
+}
+
+TEST_F(BinomialLatticeTest, AmericanPutEarlyExercisePremium) {
+    Option eu = {"TEST", 90.0, 100.0, 0.08, 0.25, 1.0, false};
+    Option am = {"TEST", 90.0, 100.0, 0.08, 0.25, 1.0, false, true};
+    double eu_price = BinomialLattice::price(eu, 200);
+    double am_price = BinomialLattice::price(am, 200);
+    EXPECT_GT(am_price, eu_price);
+    EXPECT_GE(am_price, 10.0);
+}
+
+TEST_F(BinomialLatticeTest, AmericanCallEqualsEuropean) {
+    // No dividends: early exercise of a call is never optimal
+    Option am = {"TEST", 100.0, 95.0, 0.05, 0.2, 1.0, true, true};
+    double bs_price = BlackScholes::price(am);
+    EXPECT_NEAR(BinomialLattice::price(am, 200), bs_price, bs_price * 1e-3);
+}
+
+TEST_F(BinomialLatticeTest, LowStepAccuracy) {
+    Option opt = {"TEST", 100.0, 110.0, 0.05, 0.25, 0.75, true};
+    double bs_price = BlackScholes::price(opt);
+    EXPECT_NEAR(BinomialLattice::price(opt, 50), bs_price, bs_price * 5e-3);
+}
+
+TEST_F(BinomialLatticeTest, BatchMatchesSingle) {
+    std::vector<Option> book;
+    for (int i = 0; i < 19; ++i) {
+        book.push_back({"OPT", 80.0 + 2.0 * i, 100.0, 0.04, 0.15 + 0.01 * i, 0.25 + 0.05 * i,
+                        i % 2 == 0, i % 3 == 0});
+    }
+    std::vector<double> prices(book.size()), deltas(book.size());
+    BinomialLattice::price_batch(book.data(), book.size(), 100, prices.data(), deltas.data());
+
+    for (size_t i = 0; i < book.size(); ++i) {
+        EXPECT_NEAR(prices[i], BinomialLattice::price(book[i], 100), 1e-10);
+    }
+}
+
+TEST_F(BinomialLatticeTest, DeltaMatchesBs) {
+    Option call = {"TEST", 100.0, 100.0, 0.05, 0.2, 1.0, true};
+    Option put = {"TEST", 100.0, 100.0, 0.05, 0.2, 1.0, false};
+    std::vector<Option> book = {call, put};
+    double prices[2], deltas[2];
+    BinomialLattice::price_batch(book.data(), 2, 200, prices, deltas);
+    EXPECT_NEAR(deltas[0], BlackScholes::delta(call), 5e-3);
+    EXPECT_NEAR(deltas[1], BlackScholes::delta(put), 5e-3);
+}
+
+TEST_F(BinomialLatticeTest, TooFewStepsThrows) {
+    Option opt = {"TEST", 100.0, 100.0, 0.05, 0.2, 1.0, true};
+    EXPECT_THROW(BinomialLattice::price(opt, 2), std::runtime_error);
+}
+
+TEST_F(BinomialLatticeTest, LowVolHighRateStaysValid) {
+    // σ = 3%, r = 10%: at 4 steps the branch probabilities leave [0, 1] unless steps are raised
+    Option put = {"TEST", 100.0, 100.0, 0.10, 0.03, 2.0, false};
+    Option call = {"TEST", 100.0, 100.0, 0.10, 0.03, 2.0, true};
+    for (size_t steps : {4, 1000}) {
+        double put_price = BinomialLattice::price(put, steps);
+        EXPECT_GE(put_price, 0.0);
+        EXPECT_NEAR(put_price, BlackScholes::price(put), 1e-3);
+        EXPECT_NEAR(BinomialLattice::price(call, steps), BlackScholes::price(call), 1e-2);
+    }
+
+    // A raised lane leaves the others in its group unchanged
+    Option atm = {"TEST", 100.0, 100.0, 0.05, 0.2, 1.0, true};
+    std::vector<Option> batch = {atm, put};
+    std::vector<double> prices(2);
+    BinomialLattice::price_batch(batch.data(), 2, 1000, prices.data(), nullptr);
+    EXPECT_NEAR(prices[0], BlackScholes::price(atm), BlackScholes::price(atm) * 1e-3);
+    EXPECT_NEAR(prices[1], BlackScholes::price(put), 1e-3);
+}
+
+TEST_F(BinomialLatticeTest, VanishingVolThrows) {
+    Option opt = {"TEST", 100.0, 100.0, 0.10, 1e-4, 2.0, false};
+    EXPECT_THROW(BinomialLattice::price(opt, 100), std::runtime_error);
+}
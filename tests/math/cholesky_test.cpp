@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include "math/cholesky.hpp"
+
+class CholeskyTest : public ::testing::Test {};
+
+TEST_F(CholeskyTest, KnownFactor) {
+    // [[4, 2], [2, 3]] = [[2, 0], [1, √2]]·[[2, 1], [0, √2]]
+    auto L = Cholesky::factor({4.0, 2.0, 2.0, 3.0}, 2);
+    EXPECT_NEAR(L[0], 2.0, 1e-14);
+    EXPECT_NEAR(L[1], 0.0, 1e-14);
+    EXPECT_NEAR(L[2], 1.0, 1e-14);
+    EXPECT_NEAR(L[3], std::sqrt(2.0), 1e-14);
+}
+
+TEST_F(CholeskyTest, ReconstructsCorrelation) {
+    const size_t d = 30;
+    std::vector<double> C(d * d);
+    for (size_t i = 0; i < d; ++i) {
+        for (size_t j = 0; j < d; ++j) C[i * d + j] = std::pow(0.8, std::abs(double(i) - double(j)));
+    }
+    auto L = Cholesky::factor(C, d);
+
+    for (size_t i = 0; i < d; ++i) {
+        for (size_t j = 0; j < d; ++j) {
+            double sum = 0.0;
+            for (size_t k = 0; k < d; ++k) sum += L[i * d + k] * L[j * d + k];
+            EXPECT_NEAR(sum, C[i * d + j], 1e-12);
+            if (j > i) {
+                EXPECT_EQ(L[i * d + j], 0.0);
+            }
+        }
+    }
+}
+
+TEST_F(CholeskyTest, RejectsNonPositiveDefinite) {
+    // Pairwise ρ = -0.6 between three assets is not a valid correlation matrix
+    std::vector<double> C = {1.0, -0.6, -0.6,
+                             -0.6, 1.0, -0.6,
+                             -0.6, -0.6, 1.0};
+    EXPECT_THROW(Cholesky::factor(C, 3), std::runtime_error);
+    EXPECT_THROW(Cholesky::factor({1.0, 1.0, 1.0, 1.0}, 2), std::runtime_error);
+}
+
+TEST_F(CholeskyTest, RejectsSizeMismatch) {
+    EXPECT_THROW(Cholesky::factor({1.0, 0.0, 0.0}, 2), std::runtime_error);
+}
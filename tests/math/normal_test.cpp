@@ -30,3 +30,9 @@ TEST_F(NormalTest, CdfStandardValues) {
     EXPECT_NEAR(norm_cdf(2.0), 0.9772, 1e-3);
     EXPECT_NEAR(norm_cdf(-1.0), 0.1587, 1e-3);
 }
+
+TEST_F(NormalTest, BranchlessMatchesCdf) {
+    for (double x = -8.0; x <= 8.0; x += 0.25) {
+        EXPECT_NEAR(norm_cdf_branchless(x), norm_cdf(x), 1e-12);
+    }
+}
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "core/basket_option.hpp"
+#include "math/black_scholes.hpp"
+#include "math/cholesky.hpp"
+#include "math/normal.hpp"
+#include "monte_carlo/basket.hpp"
+#include "random/ziggurat.hpp"
+
+class BasketMonteCarloTest : public ::testing::Test {
+protected:
+    static std::vector<double> constant_correlation(size_t d, double rho) {
+        std::vector<double> C(d * d, rho);
+        for (size_t i = 0; i < d; ++i) C[i * d + i] = 1.0;
+        return C;
+    }
+
+    static BasketOption exchange(BasketPayoff payoff, double rho) {
+        return {"EXCH", payoff, 0.0, 0.05, 1.0, true,
+                {100.0, 95.0}, {0.3, 0.2}, {1.0, 1.0}, constant_correlation(2, rho)};
+    }
+
+    // Margrabe: value of max(S₁ - S₂, 0)
+    static double margrabe(const BasketOption& opt) {
+        const double s1 = opt.sigmas[0], s2 = opt.sigmas[1], rho = opt.correlation[1];
+        const double sigma = std::sqrt(s1 * s1 + s2 * s2 - 2.0 * rho * s1 * s2);
+        const double d1 = (std::log(opt.spots[0] / opt.spots[1]) + 0.5 * sigma * sigma * opt.T)
+                          / (sigma * std::sqrt(opt.T));
+        return opt.spots[0] * norm_cdf(d1) - opt.spots[1] * norm_cdf(d1 - sigma * std::sqrt(opt.T));
+    }
+};
+
+TEST_F(BasketMonteCarloTest, SingleAssetMatchesBs) {
+    BasketOption opt = {"ONE", BasketPayoff::Basket, 100.0, 0.05, 1.0, true,
+                        {100.0}, {0.2}, {1.0}, {1.0}};
+    std::mt19937 rng(42);
+    double se = 0.0;
+    double price = BasketMonteCarlo::price(opt, 1000000, rng, &se);
+    double bs = BlackScholes::price(100.0, 100.0, 0.05, 0.2, 1.0, true);
+    EXPECT_NEAR(price, bs, 4.0 * se);
+    EXPECT_LT(se, 0.02);
+}
+
+TEST_F(BasketMonteCarloTest, SpreadMatchesMargrabe) {
+    for (double rho : {-0.5, 0.0, 0.7}) {
+        auto opt = exchange(BasketPayoff::Spread, rho);
+        std::mt19937 rng(7);
+        double se = 0.0;
+        double price = BasketMonteCarlo::price(opt, 500000, rng, &se);
+        EXPECT_NEAR(price, margrabe(opt), 4.0 * se) << "rho = " << rho;
+    }
+}
+
+TEST_F(BasketMonteCarloTest, RainbowMatchesMargrabe) {
+    // max(S₁, S₂) = S₂ + (S₁ - S₂)⁺ and min(S₁, S₂) = S₁ - (S₁ - S₂)⁺
+    auto best = exchange(BasketPayoff::BestOf, 0.3);
+    auto worst = exchange(BasketPayoff::WorstOf, 0.3);
+    std::mt19937 rng1(11), rng2(11);
+    double se_best = 0.0, se_worst = 0.0;
+    double best_price = BasketMonteCarlo::price(best, 500000, rng1, &se_best);
+    double worst_price = BasketMonteCarlo::price(worst, 500000, rng2, &se_worst);
+    EXPECT_NEAR(best_price, best.spots[1] + margrabe(best), 4.0 * se_best);
+    EXPECT_NEAR(worst_price, worst.spots[0] - margrabe(worst), 4.0 * se_worst);
+}
+
+TEST_F(BasketMonteCarloTest, BasketPutCallParity) {
+    // Same seed gives the same paths: C - P = Σwᵢ·Sᵢ - K·e^(-rT) up to the MC error of the forward
+    const size_t d = 20;
+    BasketOption call = {"BSK", BasketPayoff::Basket, 100.0, 0.03, 0.75, true,
+                         std::vector<double>(d, 100.0), std::vector<double>(d, 0.25),
+                         std::vector<double>(d, 1.0 / d), constant_correlation(d, 0.5)};
+    BasketOption put = call;
+    put.isCall = false;
+
+    std::mt19937 rng1(3), rng2(3);
+    double se = 0.0;
+    double c = BasketMonteCarlo::price(call, 400000, rng1, &se);
+    double p = BasketMonteCarlo::price(put, 400000, rng2);
+    EXPECT_NEAR(c - p, 100.0 - 100.0 * std::exp(-0.03 * 0.75), 4.0 * se);
+}
+
+TEST_F(BasketMonteCarloTest, BelowWeightedSingleCalls) {
+    // An equally weighted basket call is worth less than the weighted sum of single-asset calls
+    const size_t d = 5;
+    BasketOption opt = {"BSK", BasketPayoff::Basket, 100.0, 0.04, 1.0, true,
+                        std::vector<double>(d, 100.0), {0.15, 0.2, 0.25, 0.3, 0.35},
+                        std::vector<double>(d, 0.2), constant_correlation(d, 0.3)};
+    std::mt19937 rng(5);
+    double price = BasketMonteCarlo::price(opt, 200000, rng);
+    double bound = 0.0;
+    for (size_t i = 0; i < d; ++i) {
+        bound += 0.2 * BlackScholes::price(100.0, 100.0, 0.04, opt.sigmas[i], 1.0, true);
+    }
+    EXPECT_GT(price, 0.0);
+    EXPECT_LT(price, bound);
+}
+
+TEST_F(BasketMonteCarloTest, CorrelateMatchesNaive) {
+    // 7 assets exercises both the 4-row blocks and the remainder rows
+    const size_t d = 7, tile = BasketMonteCarlo::PATH_TILE;
+    std::vector<double> C(d * d);
+    for (size_t i = 0; i < d; ++i) {
+        for (size_t j = 0; j < d; ++j) C[i * d + j] = std::pow(0.6, std::abs(double(i) - double(j)));
+    }
+    auto L = Cholesky::factor(C, d);
+    std::vector<double> Z(d * tile), X(d * tile);
+    std::mt19937 rng(9);
+    ZigguratNormal::fill(Z.data(), Z.size(), rng);
+
+    BasketMonteCarlo::correlate(L.data(), d, Z.data(), X.data());
+    for (size_t i = 0; i < d; ++i) {
+        for (size_t p = 0; p < tile; ++p) {
+            double x = 0.0;
+            for (size_t k = 0; k <= i; ++k) x += L[i * d + k] * Z[k * tile + p];
+            EXPECT_NEAR(X[i * tile + p], x, 1e-12);
+        }
+    }
+}
+
+TEST_F(BasketMonteCarloTest, SampleCorrelation) {
+    const size_t d = 3, tile = BasketMonteCarlo::PATH_TILE, tiles = 800;
+    std::vector<double> C = {1.0, 0.8, -0.3,
+                             0.8, 1.0, 0.1,
+                             -0.3, 0.1, 1.0};
+    auto L = Cholesky::factor(C, d);
+    std::vector<double> Z(d * tile), X(d * tile), cross(d * d, 0.0);
+    std::mt19937 rng(13);
+    for (size_t t = 0; t < tiles; ++t) {
+        ZigguratNormal::fill(Z.data(), Z.size(), rng);
+        BasketMonteCarlo::correlate(L.data(), d, Z.data(), X.data());
+        for (size_t i = 0; i < d; ++i) {
+            for (size_t j = 0; j < d; ++j) {
+                for (size_t p = 0; p < tile; ++p) cross[i * d + j] += X[i * tile + p] * X[j * tile + p];
+            }
+        }
+    }
+    for (size_t k = 0; k < d * d; ++k) {
+        EXPECT_NEAR(cross[k] / (tiles * tile), C[k], 0.01);
+    }
+}
+
+TEST_F(BasketMonteCarloTest, Determinism) {
+    auto opt = exchange(BasketPayoff::Spread, 0.4);
+    std::mt19937 rng1(42), rng2(42);
+    EXPECT_EQ(BasketMonteCarlo::price(opt, 10001, rng1), BasketMonteCarlo::price(opt, 10001, rng2));
+}
+
+TEST_F(BasketMonteCarloTest, RejectsInvalidInputs) {
+    std::mt19937 rng(1);
+    auto opt = exchange(BasketPayoff::Spread, 0.4);
+    opt.correlation = {1.0, 1.5, 1.5, 1.0};
+    EXPECT_THROW(BasketMonteCarlo::price(opt, 100, rng), std::runtime_error);
+
+    BasketOption three = {"S3", BasketPayoff::Spread, 0.0, 0.05, 1.0, true,
+                          {1.0, 1.0, 1.0}, {0.2, 0.2, 0.2}, {1.0, 1.0, 1.0},
+                          constant_correlation(3, 0.0)};
+    EXPECT_THROW(BasketMonteCarlo::price(three, 100, rng), std::runtime_error);
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <cmath>
 #include <random>
+#include <stdexcept>
 #include "core/option.hpp"
 #include "monte_carlo/optimized.hpp"
 #include "math/black_scholes.hpp"
@@ -101,3 +102,10 @@ TEST_F(MonteCarloOptimizedTest, ConvergenceImproves) {
     
     EXPECT_LT(error_1m, error_100k);
 }
+
+TEST_F(MonteCarloOptimizedTest, AmericanOptionThrows) {
+    // European MC would return ~16.08 here, below the intrinsic value of 20
+    Option opt = {"TEST", 80.0, 100.0, 0.08, 0.25, 1.0, false, true};
+    std::mt19937 rng(42);
+    EXPECT_THROW(MonteCarloOptimized::price(opt, 1000, rng), std::runtime_error);
+}
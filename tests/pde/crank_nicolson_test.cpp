@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "core/option.hpp"
+#include "pde/crank_nicolson.hpp"
+#include "math/black_scholes.hpp"
+#include "math/normal.hpp"
+
+class CrankNicolsonTest : public ::testing::Test {
+protected:
+    static double bs_gamma(const Option& opt) {
+        double sqrt_T = std::sqrt(opt.T);
+        double d1 = (std::log(opt.S / opt.K) + (opt.r + 0.5 * opt.sigma * opt.sigma) * opt.T)
+                    / (opt.sigma * sqrt_T);
+        return phi(d1) / (opt.S * opt.sigma * sqrt_T);
+    }
+};
+
+TEST_F(CrankNicolsonTest, EuropeanCallMatchesBs) {
+    Option opt = {"TEST", 100.0, 100.0, 0.05, 0.2, 1.0, true};
+    double bs_price = BlackScholes::price(opt);
+    EXPECT_NEAR(CrankNicolson::price(opt, 401, 200), bs_price, bs_price * 1e-3);
+}
+
+TEST_F(CrankNicolsonTest, EuropeanPutMatchesBs) {
+    Option opt = {"TEST", 90.0, 100.0, 0.05, 0.3, 0.5, false};
+    double bs_price = BlackScholes::price(opt);
+    EXPECT_NEAR(CrankNicolson::price(opt, 401, 200), bs_price, bs_price * 1e-3);
+}
+
+TEST_F(CrankNicolsonTest, AmericanPutReference) {
+    // Reference value 6.0904 (high-resolution lattice)
+    Option opt = {"TEST", 100.0, 100.0, 0.05, 0.2, 1.0, false, true};
+    EXPECT_NEAR(CrankNicolson::price(opt, 801, 400), 6.0904, 5e-3);
+}
+
+TEST_F(CrankNicolsonTest, AmericanPutEarlyExercisePremium) {
+    Option eu = {"TEST", 90.0, 100.0, 0.08, 0.25, 1.0, false};
+    Option am = {"TEST", 90.0, 100.0, 0.08, 0.25, 1.0, false, true};
+    double eu_price = CrankNicolson::price(eu, 401, 200);
+    double am_price = CrankNicolson::price(am, 401, 200);
+    EXPECT_GT(am_price, eu_price);
+    EXPECT_GE(am_price, 10.0);
+}
+
+TEST_F(CrankNicolsonTest, AmericanCallEqualsEuropean) {
+    // No dividends: early exercise of a call is never optimal
+    Option am = {"TEST", 100.0, 95.0, 0.05, 0.2, 1.0, true, true};
+    double bs_price = BlackScholes::price(am);
+    EXPECT_NEAR(CrankNicolson::price(am, 401, 200), bs_price, bs_price * 1e-3);
+}
+
+TEST_F(CrankNicolsonTest, GreeksMatchBs) {
+    Option call = {"TEST", 100.0, 105.0, 0.05, 0.25, 0.5, true};
+    Option put = {"TEST", 100.0, 105.0, 0.05, 0.25, 0.5, false};
+    std::vector<Option> book = {call, put};
+    double prices[2], deltas[2], gammas[2];
+    CrankNicolson::price_batch(book.data(), 2, 401, 200, prices, deltas, gammas);
+
+    EXPECT_NEAR(deltas[0], BlackScholes::delta(call), 1e-3);
+    EXPECT_NEAR(deltas[1], BlackScholes::delta(put), 1e-3);
+    EXPECT_NEAR(gammas[0], bs_gamma(call), 1e-3);
+    EXPECT_NEAR(gammas[1], bs_gamma(put), 1e-3);
+}
+
+TEST_F(CrankNicolsonTest, ShortExpiryNoOscillation) {
+    // Rannacher start-up keeps gamma clean right after the payoff kink
+    Option opt = {"TEST", 100.0, 100.0, 0.05, 0.2, 0.02, true};
+    double price, delta, gamma;
+    CrankNicolson::price_batch(&opt, 1, 201, 50, &price, &delta, &gamma);
+    EXPECT_NEAR(price, BlackScholes::price(opt), 5e-3);
+    EXPECT_NEAR(gamma, bs_gamma(opt), bs_gamma(opt) * 0.02);
+}
+
+TEST_F(CrankNicolsonTest, DeepOutOfTheMoney) {
+    // Strike outside ±5σ√T of spot: the grid must still cover it and prices stay non-negative
+    Option call = {"TEST", 100.0, 200.0, 0.05, 0.2, 0.25, true};
+    Option put = {"TEST", 100.0, 50.0, 0.05, 0.2, 0.25, false};
+    for (const Option& opt : {call, put}) {
+        double price = CrankNicolson::price(opt, 401, 200);
+        EXPECT_GE(price, 0.0);
+        EXPECT_NEAR(price, BlackScholes::price(opt), 1e-6);
+    }
+}
+
+TEST_F(CrankNicolsonTest, DeepInTheMoneyAmericanPut) {
+    // Strike 30% above spot with low vol: immediate exercise is optimal
+    Option eu = {"TEST", 100.0, 130.0, 0.05, 0.1, 0.25, false};
+    Option am = {"TEST", 100.0, 130.0, 0.05, 0.1, 0.25, false, true};
+    EXPECT_NEAR(CrankNicolson::price(eu, 401, 200), BlackScholes::price(eu), 1e-3);
+    EXPECT_NEAR(CrankNicolson::price(am, 401, 200), 30.0, 1e-9);
+}
+
+TEST_F(CrankNicolsonTest, BatchMatchesSingle) {
+    std::vector<Option> book;
+    for (int i = 0; i < 19; ++i) {
+        book.push_back({"OPT", 80.0 + 2.0 * i, 100.0, 0.04, 0.15 + 0.01 * i, 0.25 + 0.05 * i,
+                        i % 2 == 0, i % 3 == 0});
+    }
+    std::vector<double> prices(book.size());
+    CrankNicolson::price_batch(book.data(), book.size(), 201, 100, prices.data(), nullptr, nullptr);
+
+    for (size_t i = 0; i < book.size(); ++i) {
+        EXPECT_NEAR(prices[i], CrankNicolson::price(book[i], 201, 100), 1e-10);
+    }
+}
+
+TEST_F(CrankNicolsonTest, InvalidGridThrows) {
+    Option opt = {"TEST", 100.0, 100.0, 0.05, 0.2, 1.0, true};
+    EXPECT_THROW(CrankNicolson::price(opt, 3, 100), std::runtime_error);
+    EXPECT_THROW(CrankNicolson::price(opt, 101, 0), std::runtime_error);
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include "random/ziggurat.hpp"
+#include "random/inverse_cdf.hpp"
+
+/**
+ * Statistical quality checks shared by every N(0,1) sampler
+ * Seeds are fixed, so the thresholds (well beyond 4 standard errors, or the
+ * 1% KS critical value) are deterministic rather than flaky.
+ */
+template<typename Sampler>
+class NormalSamplerTest : public ::testing::Test {
+protected:
+    static constexpr size_t N = 1'000'000;
+
+    static std::vector<double> draw(size_t n, unsigned seed) {
+        std::vector<double> z(n);
+        std::mt19937 rng(seed);
+        Sampler::fill(z.data(), n, rng);
+        return z;
+    }
+
+    static double exact_cdf(double x) {
+        return 0.5 * std::erfc(-x / std::sqrt(2.0));
+    }
+};
+
+using Samplers = ::testing::Types<ZigguratNormal, InverseCdfNormal>;
+TYPED_TEST_SUITE(NormalSamplerTest, Samplers);
+
+TYPED_TEST(NormalSamplerTest, Moments) {
+    auto z = TestFixture::draw(TestFixture::N, 42);
+    double m1 = 0.0, m2 = 0.0, m3 = 0.0, m4 = 0.0;
+    for (double x : z) {
+        m1 += x;
+        m2 += x * x;
+        m3 += x * x * x;
+        m4 += x * x * x * x;
+    }
+    const double n = static_cast<double>(z.size());
+    EXPECT_NEAR(m1 / n, 0.0, 5e-3);   // SE 1e-3
+    EXPECT_NEAR(m2 / n, 1.0, 7e-3);   // SE 1.4e-3
+    EXPECT_NEAR(m3 / n, 0.0, 1.5e-2); // SE 2.4e-3
+    EXPECT_NEAR(m4 / n, 3.0, 5e-2);   // SE 9.8e-3
+}
+
+TYPED_TEST(NormalSamplerTest, KolmogorovSmirnov) {
+    auto z = TestFixture::draw(TestFixture::N, 7);
+    std::sort(z.begin(), z.end());
+    const double n = static_cast<double>(z.size());
+    double d = 0.0;
+    for (size_t i = 0; i < z.size(); ++i) {
+        double f = TestFixture::exact_cdf(z[i]);
+        d = std::max({d, f - i / n, (i + 1) / n - f});
+    }
+    EXPECT_LT(d, 1.63 / std::sqrt(n));  // 1% critical value
+}
+
+TYPED_TEST(NormalSamplerTest, TailFrequency) {
+    auto z = TestFixture::draw(TestFixture::N, 11);
+    size_t beyond_3 = std::count_if(z.begin(), z.end(), [](double x) { return std::abs(x) > 3.0; });
+    const double expected = TestFixture::N * 2.0 * (1.0 - TestFixture::exact_cdf(3.0));  // ~2700
+    EXPECT_NEAR(static_cast<double>(beyond_3), expected, 5.0 * std::sqrt(expected));
+}
+
+TYPED_TEST(NormalSamplerTest, Determinism) {
+    auto a = TestFixture::draw(10'000, 3);
+    auto b = TestFixture::draw(10'000, 3);
+    EXPECT_EQ(a, b);
+}
+
+TYPED_TEST(NormalSamplerTest, FillMatchesSample) {
+    std::mt19937 rng1(5), rng2(5);
+    std::vector<double> filled(1000);
+    TypeParam::fill(filled.data(), filled.size(), rng1);
+    for (double x : filled) {
+        EXPECT_DOUBLE_EQ(x, TypeParam::sample(rng2));
+    }
+}
+
+class InverseCdfQuantileTest : public ::testing::Test {};
+
+TEST_F(InverseCdfQuantileTest, KnownQuantiles) {
+    EXPECT_NEAR(InverseCdfNormal::quantile(0.5), 0.0, 1e-12);
+    EXPECT_NEAR(InverseCdfNormal::quantile(0.975), 1.959963984540054, 1e-8);
+    EXPECT_NEAR(InverseCdfNormal::quantile(0.025), -1.959963984540054, 1e-8);
+    EXPECT_NEAR(InverseCdfNormal::quantile(1e-6), -4.753424308822899, 1e-7);
+}
+
+TEST_F(InverseCdfQuantileTest, RoundTrip) {
+    // Acklam's 1.15e-9 relative error in x becomes a few 1e-8 relative error in Φ(x)
+    for (double p : {1e-9, 1e-6, 1e-3, 0.02, 0.1, 0.3, 0.5, 0.7, 0.9, 0.98, 0.999}) {
+        double x = InverseCdfNormal::quantile(p);
+        EXPECT_NEAR(0.5 * std::erfc(-x / std::sqrt(2.0)) / p, 1.0, 5e-8);
+    }
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "core/option.hpp"
+#include "math/black_scholes.hpp"
+#include "risk/scenario_grid.hpp"
+#include "risk/scenario_engine.hpp"
+
+class ScenarioEngineTest : public ::testing::Test {
+protected:
+    static std::vector<Option> sample_book(size_t n) {
+        const char* names[] = {"AAPL", "MSFT", "TSLA"};
+        std::vector<Option> book;
+        for (size_t i = 0; i < n; ++i) {
+            std::string symbol = std::string(names[i % 3]) + "_" + std::to_string(i);
+            book.push_back({symbol, 90.0 + (i % 20), 100.0, 0.03 + 0.001 * (i % 7),
+                            0.15 + 0.01 * (i % 11), 0.1 + 0.05 * (i % 13), i % 2 == 0});
+        }
+        return book;
+    }
+};
+
+TEST_F(ScenarioEngineTest, LadderOrdering) {
+    auto grid = ScenarioGrid::ladder({-0.1, 0.0, 0.1}, {-0.05, 0.05}, {0.0, 0.01});
+    ASSERT_EQ(grid.size(), 12u);
+    EXPECT_DOUBLE_EQ(grid.shocks[1].spot, 0.0);
+    EXPECT_DOUBLE_EQ(grid.shocks[3].vol, 0.05);
+    EXPECT_DOUBLE_EQ(grid.shocks[6].rate, 0.01);
+}
+
+TEST_F(ScenarioEngineTest, RangeInclusive) {
+    auto values = ScenarioGrid::range(-0.2, 0.2, 0.02);
+    ASSERT_EQ(values.size(), 21u);
+    EXPECT_NEAR(values.front(), -0.2, 1e-12);
+    EXPECT_NEAR(values.back(), 0.2, 1e-12);
+}
+
+TEST_F(ScenarioEngineTest, ZeroShockZeroPnl) {
+    auto book = sample_book(300);
+    std::vector<double> qty(book.size(), 1.0);
+    auto report = ScenarioEngine::revalue(book, qty, ScenarioGrid::ladder({0.0}, {0.0}));
+    for (double pnl : report.book_pnl) EXPECT_DOUBLE_EQ(pnl, 0.0);
+}
+
+TEST_F(ScenarioEngineTest, MatchesFullRevaluation) {
+    Option opt = {"AAPL_C_100", 100.0, 105.0, 0.05, 0.25, 0.5, true};
+    Shock shock = {-0.08, 0.04, 0.01};
+    ScenarioGrid grid;
+    grid.shocks = {shock};
+
+    auto report = ScenarioEngine::revalue({opt}, {3.0}, grid);
+
+    double shocked = BlackScholes::price(opt.S * (1.0 + shock.spot), opt.K, opt.r + shock.rate,
+                                         opt.sigma + shock.vol, opt.T, opt.isCall);
+    double expected = 3.0 * (shocked - BlackScholes::price(opt));
+    EXPECT_NEAR(report.book_pnl[0], expected, 1e-9);
+}
+
+TEST_F(ScenarioEngineTest, AggregatesByUnderlying) {
+    auto book = sample_book(30);
+    std::vector<double> qty(book.size(), 1.0);
+    auto grid = ScenarioGrid::ladder({-0.1, 0.1}, {0.0});
+    auto report = ScenarioEngine::revalue(book, qty, grid);
+
+    ASSERT_EQ(report.underlyings, (std::vector<std::string>{"AAPL", "MSFT", "TSLA"}));
+    for (size_t s = 0; s < grid.size(); ++s) {
+        double sum = 0.0;
+        for (size_t u = 0; u < 3; ++u) sum += report.pnl[u * grid.size() + s];
+        EXPECT_NEAR(sum, report.book_pnl[s], 1e-9);
+    }
+}
+
+TEST_F(ScenarioEngineTest, ThreadsMatchSingleThread) {
+    auto book = sample_book(2000);
+    std::vector<double> qty(book.size(), -2.0);
+    auto grid = ScenarioGrid::ladder(ScenarioGrid::range(-0.2, 0.2, 0.05), {-0.05, 0.0, 0.05});
+
+    auto single = ScenarioEngine::revalue(book, qty, grid, 0.99, 1);
+    auto multi = ScenarioEngine::revalue(book, qty, grid, 0.99, 4);
+
+    ASSERT_EQ(single.pnl.size(), multi.pnl.size());
+    for (size_t k = 0; k < single.pnl.size(); ++k) {
+        EXPECT_NEAR(single.pnl[k], multi.pnl[k], 1e-6);
+    }
+    EXPECT_NEAR(single.book_var, multi.book_var, 1e-6);
+}
+
+TEST_F(ScenarioEngineTest, TailRisk) {
+    std::vector<double> pnl = {5.0, -1.0, -10.0, 3.0, -4.0, 0.0, 2.0, -7.0, 1.0, 6.0};
+    double var, es;
+    ScenarioEngine::tail_risk(pnl.data(), pnl.size(), 0.8, var, es);
+    EXPECT_DOUBLE_EQ(var, 7.0);
+    EXPECT_DOUBLE_EQ(es, 8.5);
+}
+
+TEST_F(ScenarioEngineTest, LongCallLosesOnSpotDrop) {
+    Option opt = {"SPY_C_400", 400.0, 400.0, 0.05, 0.2, 0.5, true};
+    auto grid = ScenarioGrid::ladder({-0.2, -0.1, 0.1, 0.2}, {0.0});
+    auto report = ScenarioEngine::revalue({opt}, {1.0}, grid, 0.75);
+    EXPECT_LT(report.book_pnl[0], report.book_pnl[1]);
+    EXPECT_GT(report.book_var, 0.0);
+    EXPECT_DOUBLE_EQ(report.book_var, -report.book_pnl[0]);
+}
+
+TEST_F(ScenarioEngineTest, MismatchedQuantitiesThrow) {
+    auto book = sample_book(3);
+    EXPECT_THROW(ScenarioEngine::revalue(book, {1.0}, ScenarioGrid::ladder({0.0}, {0.0})),
+                 std::runtime_error);
+}
+
+TEST_F(ScenarioEngineTest, AmericanPositionThrows) {
+    auto book = sample_book(3);
+    book[1].isAmerican = true;
+    std::vector<double> qty(book.size(), 1.0);
+    EXPECT_THROW(ScenarioEngine::revalue(book, qty, ScenarioGrid::ladder({0.0}, {0.0})),
+                 std::runtime_error);
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include "core/basket_option.hpp"
+#include "utils/basket_loader.hpp"
+
+namespace fs = std::filesystem;
+
+class BasketLoaderTest : public ::testing::Test {
+protected:
+    fs::path file;
+
+    void SetUp() override {
+        file = fs::temp_directory_path() / ("basket_loader_test_" + std::to_string(::getpid()) + ".csv");
+    }
+
+    void TearDown() override {
+        fs::remove(file);
+    }
+
+    void write(const std::string& rows) {
+        std::ofstream(file) << "symbol,payoff,K,r,T,isCall,spots,sigmas,weights,correlation\n" << rows;
+    }
+};
+
+TEST_F(BasketLoaderTest, ParsesAllPayoffs) {
+    write("B,basket,100,0.05,1,1,100;90;80,0.2;0.3;0.4,,0.5\n"
+          "S,spread,5,0.05,1,0,100;90,0.2;0.3,1;1,0.7\n"
+          "H,bestof,100,0.05,1,1,100;90,0.2;0.3,1;1.1,0.1\n"
+          "L,worstof,100,0.05,1,0,100;90,0.2;0.3,1;1.1,0.1\n");
+    auto opts = BasketCSVLoader::load(file.string());
+    ASSERT_EQ(opts.size(), 4u);
+    EXPECT_EQ(opts[0].payoff, BasketPayoff::Basket);
+    EXPECT_EQ(opts[1].payoff, BasketPayoff::Spread);
+    EXPECT_EQ(opts[2].payoff, BasketPayoff::BestOf);
+    EXPECT_EQ(opts[3].payoff, BasketPayoff::WorstOf);
+    EXPECT_FALSE(opts[1].isCall);
+    ASSERT_EQ(opts[0].assets(), 3u);
+    EXPECT_DOUBLE_EQ(opts[0].sigmas[2], 0.4);
+    EXPECT_DOUBLE_EQ(opts[2].weights[1], 1.1);
+}
+
+TEST_F(BasketLoaderTest, DefaultWeights) {
+    auto basket = BasketCSVLoader::parse_option("B,basket,100,0.05,1,1,100;100;100;100,0.2;0.2;0.2;0.2,,0.5");
+    for (double w : basket.weights) EXPECT_DOUBLE_EQ(w, 0.25);
+    auto best = BasketCSVLoader::parse_option("H,bestof,100,0.05,1,1,100;100,0.2;0.2,,0.5");
+    for (double w : best.weights) EXPECT_DOUBLE_EQ(w, 1.0);
+}
+
+TEST_F(BasketLoaderTest, CorrelationForms) {
+    auto constant = BasketCSVLoader::parse_option("C,basket,100,0.05,1,1,1;1;1,0.2;0.2;0.2,,0.3");
+    auto upper = BasketCSVLoader::parse_option("U,basket,100,0.05,1,1,1;1;1,0.2;0.2;0.2,,0.1;0.2;0.3");
+    auto full = BasketCSVLoader::parse_option(
+        "F,basket,100,0.05,1,1,1;1;1,0.2;0.2;0.2,,1;0.1;0.2;0.1;1;0.3;0.2;0.3;1");
+
+    for (size_t k : {1u, 2u, 3u, 5u, 6u, 7u}) EXPECT_DOUBLE_EQ(constant.correlation[k], 0.3);
+    EXPECT_EQ(upper.correlation, full.correlation);
+    EXPECT_DOUBLE_EQ(upper.correlation[1 * 3 + 2], 0.3);
+    EXPECT_DOUBLE_EQ(upper.correlation[2 * 3 + 1], 0.3);
+    EXPECT_DOUBLE_EQ(upper.correlation[4], 1.0);
+}
+
+TEST_F(BasketLoaderTest, RejectsInvalidRows) {
+    write("S,spread,5,0.05,1,1,100;90;80,0.2;0.3;0.4,1;1;1,0.5\n");
+    EXPECT_THROW(BasketCSVLoader::load(file.string()), std::runtime_error);
+    write("B,basket,100,0.05,1,1,100;90,0.2,,0.5\n");
+    EXPECT_THROW(BasketCSVLoader::load(file.string()), std::runtime_error);
+    write("B,basket,100,0.05,1,1,100;90;80,0.2;0.3;0.4,,0.5;0.5\n");
+    EXPECT_THROW(BasketCSVLoader::load(file.string()), std::runtime_error);
+    write("B,basket,100,0.05,1,1,100;90,0.2;0.3,,1.2\n");
+    EXPECT_THROW(BasketCSVLoader::load(file.string()), std::runtime_error);
+    // Symmetric, unit diagonal, |ρ| <= 1, but not positive definite
+    write("B,basket,100,0.05,1,1,100;90;80,0.2;0.3;0.4,,-0.6\n");
+    EXPECT_THROW(BasketCSVLoader::load(file.string()), std::runtime_error);
+    write("B,asian,100,0.05,1,1,100;90,0.2;0.3,,0.5\n");
+    EXPECT_THROW(BasketCSVLoader::load(file.string()), std::runtime_error);
+    EXPECT_THROW(BasketCSVLoader::load("/nonexistent/baskets.csv"), std::runtime_error);
+}
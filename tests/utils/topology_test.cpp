@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <unistd.h>
+#include "core/option.hpp"
+#include "utils/topology.hpp"
+#include "utils/numa_executor.hpp"
+
+namespace fs = std::filesystem;
+
+/**
+ * Builds a fake two-socket sysfs tree:
+ * node0 = cpus 0-3, node1 = cpus 4-7, cpu i and i+2 are SMT siblings
+ */
+class TopologyTest : public ::testing::Test {
+protected:
+    fs::path root;
+
+    void SetUp() override {
+        root = fs::temp_directory_path() / ("topology_test_" + std::to_string(::getpid()));
+        write(root / "node" / "node0" / "cpulist", "0-3");
+        write(root / "node" / "node1" / "cpulist", "4-7");
+        write(root / "node" / "online", "0-1");
+        for (unsigned cpu = 0; cpu < 8; ++cpu) {
+            fs::path topo = root / "cpu" / ("cpu" + std::to_string(cpu)) / "topology";
+            write(topo / "physical_package_id", std::to_string(cpu / 4));
+            write(topo / "core_id", std::to_string(cpu % 2));
+        }
+    }
+
+    void TearDown() override {
+        fs::remove_all(root);
+    }
+
+    static void write(const fs::path& path, const std::string& content) {
+        fs::create_directories(path.parent_path());
+        std::ofstream(path) << content << "\n";
+    }
+
+    static std::vector<unsigned> ids(const std::vector<CpuInfo>& cpus) {
+        std::vector<unsigned> out;
+        for (const auto& cpu : cpus) out.push_back(cpu.id);
+        return out;
+    }
+};
+
+TEST_F(TopologyTest, ParseCpuList) {
+    EXPECT_EQ(Topology::parse_cpulist("0-3,8,10-11"),
+              (std::vector<unsigned>{0, 1, 2, 3, 8, 10, 11}));
+}
+
+TEST_F(TopologyTest, DiscoverNodes) {
+    auto topo = Topology::discover(root.string(), false);
+    EXPECT_EQ(topo.num_nodes, 2u);
+    ASSERT_EQ(topo.cpus.size(), 8u);
+    EXPECT_EQ(topo.cpus[0].node, 0u);
+    EXPECT_EQ(topo.cpus[7].node, 1u);
+    EXPECT_EQ(topo.cpus[7].socket, 1u);
+}
+
+TEST_F(TopologyTest, CompactFillsFirstNode) {
+    auto topo = Topology::discover(root.string(), false);
+    auto slots = topo.placement(4, AffinityPolicy::Compact);
+    // Distinct cores first, then SMT siblings, all on node 0
+    EXPECT_EQ(ids(slots), (std::vector<unsigned>{0, 1, 2, 3}));
+    for (const auto& cpu : slots) EXPECT_EQ(cpu.node, 0u);
+}
+
+TEST_F(TopologyTest, ScatterAlternatesNodes) {
+    auto topo = Topology::discover(root.string(), false);
+    auto slots = topo.placement(4, AffinityPolicy::Scatter);
+    EXPECT_EQ(ids(slots), (std::vector<unsigned>{0, 4, 1, 5}));
+}
+
+TEST_F(TopologyTest, MissingSysfsFallsBack) {
+    auto topo = Topology::discover((root / "missing").string(), false);
+    EXPECT_EQ(topo.num_nodes, 1u);
+    EXPECT_FALSE(topo.cpus.empty());
+}
+
+#ifdef __linux__
+TEST_F(TopologyTest, FallbackRespectsAffinityMask) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    ASSERT_EQ(sched_getaffinity(0, sizeof(set), &set), 0);
+
+    auto topo = Topology::discover((root / "missing").string(), true);
+    ASSERT_EQ(topo.cpus.size(), static_cast<size_t>(CPU_COUNT(&set)));
+    for (const auto& cpu : topo.cpus) EXPECT_TRUE(CPU_ISSET(cpu.id, &set)) << "cpu " << cpu.id;
+}
+
+TEST_F(TopologyTest, ExecutorReportsPinFailures) {
+    // A CPU that does not exist: pinning fails, the workers still run unpinned
+    Topology topo;
+    topo.cpus = {{CPU_SETSIZE - 1, 0, 0, 0}};
+    std::vector<Option> options = {{"OPT", 100.0, 100.0, 0.05, 0.2, 1.0, true}};
+
+    NumaExecutor executor(topo, 1, AffinityPolicy::Compact);
+    auto results = executor.run(options, [](const Option* opts, size_t count, Result* out, unsigned) {
+        for (size_t i = 0; i < count; ++i) out[i] = {opts[i].symbol, 1.0, 0.0, 0.0};
+    });
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(executor.pin_failures(), 1u);
+
+    NumaExecutor unpinned(topo, 2, AffinityPolicy::None);
+    unpinned.run(options, [](const Option*, size_t, Result*, unsigned) {});
+    EXPECT_EQ(unpinned.pin_failures(), 0u);
+}
+#endif
+
+TEST_F(TopologyTest, PinnedPoolCappedAtCpus) {
+    auto topo = Topology::discover(root.string(), false);
+    for (auto policy : {AffinityPolicy::Compact, AffinityPolicy::Scatter}) {
+        NumaExecutor executor(topo, 32, policy);
+        auto slots = ids(executor.slots());
+        ASSERT_EQ(slots.size(), 8u);
+        std::sort(slots.begin(), slots.end());
+        EXPECT_EQ(std::unique(slots.begin(), slots.end()), slots.end());
+    }
+    // Unpinned workers are left to the scheduler, so oversubscription is allowed
+    EXPECT_EQ(NumaExecutor(topo, 32, AffinityPolicy::None).slots().size(), 32u);
+}
+
+TEST_F(TopologyTest, ParseAffinity) {
+    EXPECT_EQ(parse_affinity("compact"), AffinityPolicy::Compact);
+    EXPECT_EQ(parse_affinity("scatter"), AffinityPolicy::Scatter);
+    EXPECT_EQ(parse_affinity("none"), AffinityPolicy::None);
+    EXPECT_THROW(parse_affinity("spread"), std::runtime_error);
+}
+
+TEST_F(TopologyTest, ExecutorPreservesOrder) {
+    auto topo = Topology::discover();
+    std::vector<Option> options;
+    for (int i = 0; i < 37; ++i) {
+        options.push_back({"OPT" + std::to_string(i), 100.0, 50.0 + i, 0.05, 0.2, 1.0, true});
+    }
+
+    NumaExecutor executor(topo, 3, AffinityPolicy::Compact);
+    auto results = executor.run(options, [](const Option* opts, size_t count, Result* out, unsigned) {
+        for (size_t i = 0; i < count; ++i) out[i] = {opts[i].symbol, opts[i].K, 0.0, 0.0};
+    });
+
+    ASSERT_EQ(results.size(), options.size());
+    for (size_t i = 0; i < options.size(); ++i) {
+        EXPECT_EQ(results[i].symbol, options[i].symbol);
+        EXPECT_DOUBLE_EQ(results[i].price, options[i].K);
+    }
+
+    size_t total = 0;
+    for (const auto& node : executor.node_stats()) total += node.options;
+    EXPECT_EQ(total, options.size());
+}
+
+TEST_F(TopologyTest, ExecutorGenericTypes) {
+    auto topo = Topology::discover();
+    std::vector<int> inputs(25);
+    for (int i = 0; i < 25; ++i) inputs[i] = i;
+
+    NumaExecutor executor(topo, 4, AffinityPolicy::None);
+    auto squares = executor.run<double>(inputs, [](const int* in, size_t count, double* out, unsigned) {
+        for (size_t i = 0; i < count; ++i) out[i] = static_cast<double>(in[i]) * in[i];
+    });
+    ASSERT_EQ(squares.size(), inputs.size());
+    for (int i = 0; i < 25; ++i) EXPECT_DOUBLE_EQ(squares[i], i * i);
+}
+
+TEST_F(TopologyTest, ExecutorRethrowsWorkerException) {
+    auto topo = Topology::discover();
+    std::vector<Option> options(8, Option{"OPT", 100.0, 100.0, 0.05, 0.2, 1.0, true});
+
+    NumaExecutor executor(topo, 4, AffinityPolicy::None);
+    EXPECT_THROW(executor.run(options, [](const Option*, size_t, Result*, unsigned t) {
+        if (t == 2) throw std::runtime_error("worker failed");
+    }), std::runtime_error);
+}
+
+TEST_F(TopologyTest, ExecutorBalancesPartitions) {
+    auto topo = Topology::discover();
+    for (auto [size, workers] : {std::pair<size_t, unsigned>{12, 16}, {37, 4}, {100, 7}, {3, 3}}) {
+        std::vector<int> inputs(size, 0);
+        std::vector<size_t> counts(workers, 0);
+
+        NumaExecutor executor(topo, workers, AffinityPolicy::None);
+        executor.run<int>(inputs, [&](const int*, size_t count, int*, unsigned t) { counts[t] = count; });
+
+        const size_t ceiling = (size + workers - 1) / workers;
+        size_t total = 0;
+        for (size_t count : counts) {
+            EXPECT_LE(count, ceiling) << size << " items on " << workers << " workers";
+            total += count;
+        }
+        EXPECT_EQ(total, size);
+    }
+}